@@ -8,6 +8,7 @@
  */
 
 #include <iostream>
+#include <algorithm>
 #include <thread>
 #include <vector>
 #include <queue>
@@ -18,6 +19,7 @@
 #include <latch>
 #include <random>
 #include "lockfree/mpmc_queue.hpp"
+#include "lockfree/ms_queue.hpp"
 
 using namespace std::chrono;
 using Clock = high_resolution_clock;
@@ -48,6 +50,23 @@ private:
     std::queue<T> queue_;
 };
 
+// ============================================================================
+// Unbounded Michael-Scott queue (push never fails)
+// ============================================================================
+template<typename T>
+class UnboundedQueue {
+public:
+    bool push(const T& value) {
+        queue_.push(value);
+        return true;
+    }
+    bool pop(T& value) {
+        return queue_.pop(value);
+    }
+private:
+    lockfree::MSQueue<T> queue_;
+};
+
 // ============================================================================
 // Simulate work (CPU-bound task)
 // ============================================================================
@@ -179,6 +198,103 @@ BenchResult<Queue> run_realistic_benchmark(
     return {throughput, avg_latency, p99_latency};
 }
 
+// ============================================================================
+// Bursty producers: push a burst back-to-back, then go idle
+// ============================================================================
+// Bounded rings fill up during a burst and stall the producer (push retries);
+// an unbounded queue absorbs the burst and lets consumers catch up while idle.
+template<typename Queue>
+BenchResult<Queue> run_bursty_benchmark(
+    int num_producers,
+    int num_consumers,
+    int bursts_per_producer,
+    int burst_size,
+    int idle_iterations  // Simulated work between bursts
+) {
+    Queue queue;
+
+    const int total_threads = num_producers + num_consumers;
+    std::latch start_latch(total_threads + 1);
+    std::latch end_latch(total_threads);
+
+    std::vector<long long> all_latencies;
+    std::mutex latency_mutex;
+    std::atomic<int> remaining{num_producers * bursts_per_producer * burst_size};
+
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < num_producers; ++p) {
+        threads.emplace_back([&, p]() {
+            std::vector<long long> local_latencies;
+            local_latencies.reserve(bursts_per_producer);
+
+            start_latch.arrive_and_wait();
+
+            for (int b = 0; b < bursts_per_producer; ++b) {
+                // Latency = time to hand off the whole burst
+                auto t1 = Clock::now();
+                for (int i = 0; i < burst_size; ++i) {
+                    while (!queue.push(p * burst_size + i)) {
+                        std::this_thread::yield();
+                    }
+                }
+                auto t2 = Clock::now();
+                local_latencies.push_back(duration_cast<nanoseconds>(t2 - t1).count());
+
+                simulate_work(idle_iterations);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(latency_mutex);
+                all_latencies.insert(all_latencies.end(),
+                    local_latencies.begin(), local_latencies.end());
+            }
+
+            end_latch.count_down();
+        });
+    }
+
+    for (int c = 0; c < num_consumers; ++c) {
+        threads.emplace_back([&]() {
+            start_latch.arrive_and_wait();
+
+            int value;
+            while (remaining.load(std::memory_order_relaxed) > 0) {
+                if (queue.pop(value)) {
+                    remaining.fetch_sub(1, std::memory_order_relaxed);
+                    simulate_work(50);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+
+            end_latch.count_down();
+        });
+    }
+
+    auto start = Clock::now();
+    start_latch.arrive_and_wait();
+    end_latch.wait();
+    auto end = Clock::now();
+
+    for (auto& t : threads) t.join();
+
+    double elapsed_sec = duration_cast<microseconds>(end - start).count() / 1000000.0;
+    int total_ops = num_producers * bursts_per_producer * burst_size * 2;
+    double throughput = total_ops / elapsed_sec;
+
+    std::sort(all_latencies.begin(), all_latencies.end());
+
+    double avg_latency = 0;
+    for (auto l : all_latencies) avg_latency += l;
+    avg_latency /= all_latencies.size();
+
+    size_t p99_idx = static_cast<size_t>(all_latencies.size() * 0.99);
+    double p99_latency = static_cast<double>(all_latencies[p99_idx]);
+
+    return {throughput, avg_latency, p99_latency};
+}
+
 void print_bar(double value, double max_value, int width = 25) {
     int filled = static_cast<int>((value / max_value) * width);
     std::cout << "[";
@@ -265,6 +381,48 @@ int main() {
                   << (lf.p99_latency_ns / mx.p99_latency_ns) << "x better P99 latency\n";
     }
     
+    // Bursty producers: bounded ring vs unbounded linked queue
+    std::cout << "\n================================================================\n";
+    std::cout << "       Bursty Producers (MPMCQueue vs MSQueue)\n";
+    std::cout << "================================================================\n";
+    std::cout << "  Producers push bursts larger than the ring, then go idle\n\n";
+
+    struct BurstCase {
+        int producers;
+        int consumers;
+        int bursts;
+        int burst_size;
+        int idle_iterations;
+        const char* name;
+    };
+
+    std::vector<BurstCase> burst_tests = {
+        {4, 4, 200, 1024, 20000, "4P-4C burst 1K"},
+        {4, 4, 50, 8192, 80000, "4P-4C burst 8K"},
+        {8, 2, 50, 8192, 80000, "8P-2C burst 8K"},
+    };
+
+    std::cout << "+----------------------+------------+------------+--------------+--------------+\n";
+    std::cout << "|      Scenario        | MPMCQueue  |  MSQueue   | MPMC p99     | MS p99       |\n";
+    std::cout << "|                      | (M ops/s)  | (M ops/s)  | burst (us)   | burst (us)   |\n";
+    std::cout << "+----------------------+------------+------------+--------------+--------------+\n";
+
+    for (const auto& test : burst_tests) {
+        auto ring = run_bursty_benchmark<lockfree::MPMCQueue<int, QUEUE_CAPACITY>>(
+            test.producers, test.consumers, test.bursts, test.burst_size, test.idle_iterations);
+        auto linked = run_bursty_benchmark<UnboundedQueue<int>>(
+            test.producers, test.consumers, test.bursts, test.burst_size, test.idle_iterations);
+
+        std::cout << "| " << std::left << std::setw(20) << test.name << " |"
+                  << std::right << std::setw(10) << std::fixed << std::setprecision(2)
+                  << (ring.throughput / 1000000.0) << "  |"
+                  << std::setw(10) << (linked.throughput / 1000000.0) << "  |"
+                  << std::setw(12) << std::setprecision(0) << (ring.p99_latency_ns / 1000.0) << "  |"
+                  << std::setw(12) << (linked.p99_latency_ns / 1000.0) << "  |\n";
+    }
+
+    std::cout << "+----------------------+------------+------------+--------------+--------------+\n";
+
     std::cout << "\n================================================================\n";
     std::cout << "                    Benchmark Complete\n";
     std::cout << "================================================================\n\n";
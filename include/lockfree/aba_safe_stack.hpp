@@ -1,22 +1,42 @@
 /**
- * ABA-Safe Lock-Free Stack using Packed Tagged Pointer
+ * ABA-Safe Lock-Free Stack using Tagged Pointer
  * 
- * Packed Tagged Pointer 방식으로 ABA 문제를 해결한 Lock-Free Stack
+ * (포인터, 태그) 쌍을 CAS 한 번으로 바꿔 ABA 문제를 해결한 Lock-Free Stack
  * 
  * 핵심 아이디어:
- *   x64에서 가상 주소는 48비트만 사용 → 상위 16비트를 태그로 활용
- *   8바이트 atomic으로 진짜 lock-free 보장!
+ *   head를 바꿀 때마다 태그를 1 증가 → 같은 노드가 다시 head가 되어도
+ *   태그가 달라서 낡은 CAS는 실패
  * 
  * ┌─────────────────────────────────────────────────────────┐
- * │  64-bit atomic value (std::uintptr_t)                   │
- * ├─────────────────┬───────────────────────────────────────┤
- * │  Tag (16 bits)  │  Pointer (48 bits)                    │
+ * │  AtomicTaggedPtr<Node> (tagged_ptr.hpp)                 │
+ * ├─────────────────────────────┬───────────────────────────┤
+ * │  Pointer (64 bits)          │  Tag (64 bits)            │  128비트 CAS
+ * ├─────────────────┬───────────┴───────────────────────────┤
+ * │  Tag (16 bits)  │  Pointer (48 bits)                    │  fallback
  * └─────────────────┴───────────────────────────────────────┘
  * 
- * 왜 8바이트여야 하는가?
- *   - x64 CPU는 8바이트 CAS를 하드웨어로 지원 (lock cmpxchg)
- *   - 16바이트는 CMPXCHG16B 필요 → 일부 플랫폼에서 미지원
- *   - std::atomic<16bytes>는 내부 mutex 사용할 수 있음!
+ * 왜 std::atomic<16bytes>를 쓰지 않는가?
+ *   - 컴파일러가 내부 mutex(libatomic)로 구현할 수 있음 → lock-free 아님
+ *   - AtomicTaggedPtr은 CMPXCHG16B를 직접 쓰고, 없으면 8바이트 패킹으로 대체
+ *
+ * 태그만으로는 부족한 이유 (use-after-free):
+ *   Thread A: old = head; next = old->next ...
+ *   Thread B: pop() → old 해제
+ *   Thread A: old->next 읽기 → 해제된 메모리!  (태그는 CAS 실패만 보장)
+ *   → pop은 hazard pointer로 old를 보호하고, 해제는 retire로 미룸
+ *     (Reclaimer 정책, 기본값 HazardPointerReclaimer)
+ *
+ * 읽기마다 fence를 피하려면 EBR 정책 (epoch.hpp):
+ *   ABASafeStack<T, EpochReclaimer> stack;
+ *
+ * 노드 할당 (Allocator 정책, 기본값 MemoryPool):
+ *   push/pop마다 전역 new/delete를 부르지 않음 → 풀의 free list CAS 한 번
+ *   retire된 노드는 묶음으로 풀에 반환 (destroy_bulk, CAS 한 번)
+ *   ABASafeStack<T, HazardPointerReclaimer, HeapAllocator>로 new/delete 사용
+ *
+ * 묶음 연산 (원소당 CAS 대신 묶음당 CAS 한 번):
+ *   push_list(first, last): 미리 연결한 노드 사슬을 통째로 올림
+ *   pop_all():              head를 nullptr로 바꿔 사슬 전체를 가져옴
  */
 
 #pragma once
@@ -24,19 +44,33 @@
 #include <atomic>
 #include <optional>
 #include <cstdint>
+#include <cstddef>
 #include <cassert>
+#include <utility>
+
+#include "hazard_pointer.hpp"
+#include "epoch.hpp"
+#include "memory_pool.hpp"
+#include "tagged_ptr.hpp"
 
 namespace lockfree {
 
 /**
- * ABA-Safe Lock-Free Stack (Treiber Stack with Packed Tagged Pointer)
+ * ABA-Safe Lock-Free Stack (Treiber Stack with Tagged Pointer)
  * 
  * 진짜 Lock-Free를 보장하는 구현
+ *
+ * @tparam Reclaimer 노드 해제 시점을 정하는 정책
+ *                   (HazardPointerReclaimer 또는 EpochReclaimer)
+ * @tparam Allocator 노드 할당자 (MemoryPool 또는 HeapAllocator)
+ *                   construct(args...), destroy(p), destroy_bulk(ptrs, n) 제공
  */
-template <typename T>
+template <typename T,
+          typename Reclaimer = HazardPointerReclaimer,
+          template <typename> class Allocator = MemoryPool>
 class ABASafeStack {
 public:
-    struct Node {
+    struct Node : Reclaimer::node_base {
         T data;
         Node* next;
         
@@ -45,53 +79,35 @@ public:
     };
 
 private:
-    /**
-     * Packed Tagged Pointer
-     * 
-     * 64비트를 다음과 같이 분할:
-     *   [63:48] = 16비트 태그 (0 ~ 65535, 오버플로우 시 wrap around)
-     *   [47:0]  = 48비트 포인터 (x64 가상 주소 공간)
-     * 
-     * x64에서 canonical address:
-     *   - 유저 공간: 0x0000_0000_0000_0000 ~ 0x0000_7FFF_FFFF_FFFF
-     *   - 커널 공간: 0xFFFF_8000_0000_0000 ~ 0xFFFF_FFFF_FFFF_FFFF
-     *   → 상위 16비트는 sign extension이므로 태그로 사용 가능!
-     */
-    static constexpr int TAG_BITS = 16;
-    static constexpr int PTR_BITS = 48;
-    static constexpr std::uintptr_t PTR_MASK = (1ULL << PTR_BITS) - 1;
-    static constexpr std::uintptr_t TAG_MASK = ~PTR_MASK;
-    
-    // 포인터 → packed 값
-    static std::uintptr_t pack(Node* ptr, std::uint16_t tag) {
-        std::uintptr_t p = reinterpret_cast<std::uintptr_t>(ptr) & PTR_MASK;
-        std::uintptr_t t = static_cast<std::uintptr_t>(tag) << PTR_BITS;
-        return p | t;
-    }
-    
-    // packed 값 → 포인터
-    static Node* get_ptr(std::uintptr_t packed) {
-        return reinterpret_cast<Node*>(packed & PTR_MASK);
-    }
-    
-    // packed 값 → 태그
-    static std::uint16_t get_tag(std::uintptr_t packed) {
-        return static_cast<std::uint16_t>(packed >> PTR_BITS);
+    using domain_type = typename Reclaimer::domain_type;
+    using guard_type = typename Reclaimer::guard_type;
+
+    // 안전해진 노드 묶음을 할당자에 반환 (domain이 호출)
+    static void reclaim_nodes(typename Reclaimer::node_base* const* nodes,
+                              std::size_t count, void* context) {
+        static_cast<ABASafeStack*>(context)->allocator_.destroy_bulk(nodes, count);
     }
 
-    // head를 8바이트 atomic으로 관리 → 진짜 lock-free!
-    std::atomic<std::uintptr_t> head_;
+    // 노드 할당자 (domain_보다 먼저 생성/나중에 소멸: domain 소멸 시 여기로 반환)
+    Allocator<Node> allocator_;
+
+    // head = (top 노드, 태그) → 진짜 lock-free!
+    AtomicTaggedPtr<Node> head_;
+
+    // pop된 노드의 해제를 미루는 곳 (소멸 시 남은 노드 모두 해제)
+    domain_type domain_{&reclaim_nodes, this};
 
 public:
-    ABASafeStack() : head_(pack(nullptr, 0)) {
+    ABASafeStack() {
         // Lock-free 보장 확인 (컴파일 타임)
-        static_assert(sizeof(std::uintptr_t) == 8, "Requires 64-bit platform");
-        static_assert(std::atomic<std::uintptr_t>::is_always_lock_free, 
-                      "std::atomic<uintptr_t> must be lock-free");
+        static_assert(sizeof(void*) == 8, "Requires 64-bit platform");
+        static_assert(AtomicTaggedPtr<Node>::is_always_lock_free,
+                      "AtomicTaggedPtr must be lock-free");
     }
     
     ~ABASafeStack() {
         while (pop()) {}
+        // 이후 domain_ 소멸자가 retire된 노드를 모두 allocator_에 반환
     }
     
     // 복사/이동 금지
@@ -104,26 +120,40 @@ public:
      * Push 연산 - 새 노드를 스택 top에 추가
      * 
      * 알고리즘:
-     * 1. 새 노드 생성
+     * 1. 새 노드 생성 (할당자에서)
      * 2. 현재 head(packed)를 읽음
      * 3. 새 노드의 next를 현재 head의 포인터로 설정
-     * 4. CAS로 head를 pack(new_node, old_tag + 1)로 변경
+     * 4. CAS로 head를 (new_node, old_tag + 1)로 변경
      * 5. 실패하면 2번부터 재시도
      * 
      * @param value 추가할 값
      */
     void push(const T& value) {
-        Node* new_node = new Node(value);
-        std::uintptr_t old_head = head_.load(std::memory_order_relaxed);
-        
-        do {
-            new_node->next = get_ptr(old_head);
-        } while (!head_.compare_exchange_weak(
+        Node* new_node = create_node(value);
+        while (!try_push_node(new_node)) {}
+    }
+
+    void push(T&& value) {
+        Node* new_node = create_node(std::move(value));
+        while (!try_push_node(new_node)) {}
+    }
+
+    /**
+     * Push 한 번 시도 (CAS 한 번)
+     *
+     * 경합으로 실패하면 false → 호출자가 재시도 전략을 정함
+     * (EliminationBackoffStack은 실패 시 소거 배열로 우회)
+     *
+     * @param node 아직 스택에 없는 노드 (성공하면 소유권이 스택으로)
+     */
+    bool try_push_node(Node* node) {
+        TaggedPtr<Node> old_head = head_.load(std::memory_order_relaxed);
+        node->next = old_head.ptr();
+        return head_.compare_exchange_strong(
             old_head,
-            pack(new_node, get_tag(old_head) + 1),
+            old_head.advanced(node),
             std::memory_order_release,
-            std::memory_order_relaxed
-        ));
+            std::memory_order_relaxed);
     }
 
     /**
@@ -132,52 +162,195 @@ public:
      * 알고리즘:
      * 1. 현재 head(packed)를 읽음
      * 2. head의 포인터가 nullptr이면 실패
-     * 3. CAS로 head를 pack(ptr->next, old_tag + 1)로 변경
+     * 3. CAS로 head를 (ptr->next, old_tag + 1)로 변경
      * 4. 실패하면 1번부터 재시도
-     * 5. 성공하면 데이터 추출 후 노드 삭제
+     * 5. 성공하면 데이터 추출 후 노드 retire (바로 delete하지 않음)
      * 
      * ABA 문제 해결:
      *   다른 스레드가 A를 pop하고 다시 push해도
      *   태그가 증가하므로 CAS가 실패함!
+     *
+     * Use-after-free 방지:
+     *   1번에서 읽은 노드를 guard로 보호 (hazard pointer 게시 또는 epoch pin)
+     *   → 3번에서 ptr->next를 읽는 동안 다른 스레드가 pop해도 해제되지 않음
      * 
      * @return 제거된 값 (스택이 비었으면 nullopt)
      */
     std::optional<T> pop() {
-        std::uintptr_t old_head = head_.load(std::memory_order_relaxed);
-        
+        std::optional<T> result;
+        while (!try_pop(result)) {}
+        return result;
+    }
+
+    /**
+     * Pop 한 번 시도 (CAS 한 번)
+     *
+     * @param result 꺼낸 값 (스택이 비었으면 nullopt)
+     * @return false = 경합으로 CAS 실패 (result는 그대로, 재시도 필요)
+     */
+    bool try_pop(std::optional<T>& result) {
+        guard_type guard(domain_);
+
+        // head를 읽고 그 노드를 보호 (보호 후 head가 그대로인지 확인)
+        TaggedPtr<Node> old_head = guard.protect(head_, [](TaggedPtr<Node> v) { return v.ptr(); });
+        Node* old_ptr = old_head.ptr();
+        if (old_ptr == nullptr) {
+            result.reset();
+            return true;
+        }
+
+        // CAS: head를 ptr->next로 변경 (태그 증가)
+        // old_ptr는 보호 중이므로 next 읽기가 안전
+        if (!head_.compare_exchange_strong(
+                old_head,
+                old_head.advanced(old_ptr->next),
+                std::memory_order_acquire,
+                std::memory_order_relaxed)) {
+            return false;
+        }
+
+        // CAS 성공 = 이 스레드만 data에 접근 (다른 스레드는 next만 읽을 수 있음)
+        result.emplace(std::move(old_ptr->data));
+        guard.reset_protection();
+        domain_.retire(old_ptr);
+        return true;
+    }
+
+    // ========================================
+    // 묶음 연산
+    // ========================================
+
+    /**
+     * 미리 연결한 노드 사슬을 CAS 한 번으로 올림
+     *
+     * first → ... → last 순서로 next가 연결되어 있어야 함 (last->next는 덮어씀)
+     * 노드는 create_node()로 만든 것이어야 함
+     * push 후 first가 새 top (사슬 순서 그대로 pop됨)
+     */
+    void push_list(Node* first, Node* last) {
+        TaggedPtr<Node> old_head = head_.load(std::memory_order_relaxed);
         do {
-            Node* old_ptr = get_ptr(old_head);
-            if (old_ptr == nullptr) {
-                return std::nullopt;
-            }
-            
-            // CAS: head를 ptr->next로 변경 (태그 증가)
+            last->next = old_head.ptr();
         } while (!head_.compare_exchange_weak(
             old_head,
-            pack(get_ptr(old_head)->next, get_tag(old_head) + 1),
-            std::memory_order_acquire,
-            std::memory_order_relaxed
-        ));
+            old_head.advanced(first),
+            std::memory_order_release,
+            std::memory_order_relaxed));
+    }
 
-        Node* old_ptr = get_ptr(old_head);
-        T value = std::move(old_ptr->data);
-        delete old_ptr;
-        return value;
+    /**
+     * 스택 전체를 CAS 한 번으로 가져옴
+     *
+     * 돌려받은 사슬은 top부터 순회 가능하고, PoppedList가 소멸할 때
+     * 모든 노드를 retire함 (다른 pop이 아직 노드를 읽고 있을 수 있으므로
+     * 바로 해제하지 않음)
+     */
+    class PoppedList;
+
+    PoppedList pop_all() {
+        TaggedPtr<Node> old_head = head_.load(std::memory_order_relaxed);
+        while (old_head.ptr() != nullptr &&
+               !head_.compare_exchange_weak(
+                   old_head,
+                   old_head.advanced(nullptr),
+                   std::memory_order_acquire,
+                   std::memory_order_relaxed)) {
+        }
+        return PoppedList(*this, old_head.ptr());
+    }
+
+    /**
+     * push_list용 노드 생성 (할당자에서)
+     */
+    template <typename U>
+    Node* create_node(U&& value) {
+        Node* node = allocator_.construct(std::forward<U>(value));
+        assert(node != nullptr && "Node allocator exhausted");
+        return node;
+    }
+
+    /**
+     * 스택에 한 번도 들어가지 않은 노드를 바로 해제
+     *
+     * (다른 스레드가 볼 수 없었던 노드만 - 예: 소거로 넘겨받은 노드)
+     */
+    void destroy_node(Node* node) {
+        allocator_.destroy(node);
     }
 
     /**
      * 스택이 비어있는지 확인
      */
     bool empty() const {
-        return get_ptr(head_.load(std::memory_order_acquire)) == nullptr;
+        return head_.load(std::memory_order_acquire).ptr() == nullptr;
     }
     
     /**
      * Lock-Free 여부 확인 (디버깅용)
      */
     static bool is_lock_free() {
-        return std::atomic<std::uintptr_t>::is_always_lock_free;
+        return AtomicTaggedPtr<Node>::is_always_lock_free;
     }
 };
 
+// ============================================
+// PoppedList: pop_all()이 돌려주는 사슬 (top → bottom)
+// ============================================
+// 복사/이동 금지 (반환값은 guaranteed copy elision으로 전달)
+template <typename T, typename Reclaimer, template <typename> class Allocator>
+class ABASafeStack<T, Reclaimer, Allocator>::PoppedList {
+public:
+    class iterator {
+    public:
+        explicit iterator(Node* node) : node_(node) {}
+
+        T& operator*() const { return node_->data; }
+        T* operator->() const { return &node_->data; }
+
+        iterator& operator++() {
+            node_ = node_->next;
+            return *this;
+        }
+
+        bool operator==(const iterator&) const = default;
+
+    private:
+        Node* node_;
+    };
+
+    PoppedList(ABASafeStack& owner, Node* first)
+        : owner_(owner), first_(first) {}
+
+    ~PoppedList() {
+        Node* node = first_;
+        while (node != nullptr) {
+            Node* next = node->next;
+            owner_.domain_.retire(node);
+            node = next;
+        }
+    }
+
+    PoppedList(const PoppedList&) = delete;
+    PoppedList& operator=(const PoppedList&) = delete;
+    PoppedList(PoppedList&&) = delete;
+    PoppedList& operator=(PoppedList&&) = delete;
+
+    iterator begin() const { return iterator(first_); }
+    iterator end() const { return iterator(nullptr); }
+
+    bool empty() const { return first_ == nullptr; }
+
+    std::size_t size() const {
+        std::size_t count = 0;
+        for (Node* node = first_; node != nullptr; node = node->next) {
+            ++count;
+        }
+        return count;
+    }
+
+private:
+    ABASafeStack& owner_;
+    Node* first_;
+};
+
 } // namespace lockfree
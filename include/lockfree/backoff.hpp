@@ -0,0 +1,301 @@
+/**
+ * Backoff Policies - 스핀/재시도 루프의 물러나기 전략
+ *
+ * 경합 상황에서 CAS가 실패하면 곧바로 다시 시도하는 것이 최선이 아님
+ *   - 4코어 엣지 박스: 짧게 pause 후 재시도가 유리
+ *   - 64코어 서버:     모두가 동시에 재시도 → 캐시라인 폭주
+ *                      → 지수적으로 물러나고, 무작위로 흩어야 유리
+ *
+ * 그래서 전략을 템플릿 인자로 주입 (정책 기반 설계):
+ *
+ * ┌───────────────────────────┬─────────────────────────────────┐
+ * │  정책                      │  pause() 한 번의 동작            │
+ * ├───────────────────────────┼─────────────────────────────────┤
+ * │  NoBackoff                │  아무것도 안 함 (즉시 재시도)    │
+ * │  ConstantBackoff<N>       │  pause N번                      │
+ * │  ExponentialBackoff<L,H>  │  pause L, 2L, 4L, ... H (상한)  │
+ * │  JitteredBackoff<L,H>     │  위와 같되 [1, limit] 무작위     │
+ * │  HybridBackoff<S,Y>       │  S번 pause → Y번 yield → block  │
+ * │  AdaptiveBackoff<L,H>     │  락별로 학습한 횟수 → block     │
+ * └───────────────────────────┴─────────────────────────────────┘
+ *
+ * 사용 방법 (재시도 루프마다 새 객체):
+ *   Backoff backoff;
+ *   while (!try_something()) {
+ *       if (backoff.should_block()) { ... OS 대기 (futex) ... }
+ *       backoff.pause();
+ *   }
+ *
+ * should_block()은 "스핀 예산을 다 썼으니 OS에게 맡겨라"라는 신호
+ *   - 락(SpinLock)은 이때 locked_.wait()로 넘어감
+ *   - 큐(MPMCQueue/MPSCQueue)는 블로킹하지 않으므로 무시함
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+// 플랫폼별 pause 명령어 정의
+#if defined(_MSC_VER)
+    #include <intrin.h>
+    #define SPIN_PAUSE() _mm_pause()
+#elif defined(__x86_64__) || defined(__i386__)
+    #define SPIN_PAUSE() __builtin_ia32_pause()
+#elif defined(__arm__) || defined(__aarch64__)
+    #define SPIN_PAUSE() __asm__ __volatile__("yield")
+#else
+    #define SPIN_PAUSE() ((void)0)
+#endif
+
+namespace lockfree {
+
+/**
+ * Backoff 정책 요구사항
+ *
+ * - 기본 생성 가능 (재시도 루프마다 새로 만듦)
+ * - pause():        한 번 물러남
+ * - reset():        처음 상태로 (성공 후 재사용 시)
+ * - should_block(): 스핀 예산 소진 여부
+ */
+template <typename B>
+concept BackoffPolicy = std::default_initializable<B> && requires(B& b, const B& cb) {
+    b.pause();
+    b.reset();
+    { cb.should_block() } -> std::convertible_to<bool>;
+};
+
+namespace detail {
+
+/**
+ * 스레드별 xorshift32 (공유 상태 없음, 락 없음)
+ *
+ * 백오프 지터, 소거 배열 슬롯 선택처럼 "스레드끼리 흩어지기만 하면 되는" 곳에 사용
+ */
+inline std::uint32_t thread_random_seed() {
+    // 스레드마다 다른 시드: thread_local 변수의 주소 + 스레드 id
+    thread_local char marker;
+    auto addr = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&marker));
+    auto id = static_cast<std::uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    std::uint32_t s = addr ^ (id * 2654435761u);
+    return s != 0 ? s : 0x9E3779B9u;  // xorshift는 0이면 멈춤
+}
+
+inline std::uint32_t thread_random() {
+    thread_local std::uint32_t state = thread_random_seed();
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+} // namespace detail
+
+// ============================================
+// NoBackoff: 즉시 재시도 (기존 큐 동작)
+// ============================================
+struct NoBackoff {
+    void pause() {}
+    void reset() {}
+    bool should_block() const { return false; }
+};
+
+// ============================================
+// ConstantBackoff: 매번 같은 양만큼 pause
+// ============================================
+template <std::uint32_t Pauses = 1>
+struct ConstantBackoff {
+    static_assert(Pauses > 0, "Pauses must be positive");
+
+    void pause() {
+        for (std::uint32_t i = 0; i < Pauses; ++i) {
+            SPIN_PAUSE();
+        }
+    }
+    void reset() {}
+    bool should_block() const { return false; }
+};
+
+// ============================================
+// ExponentialBackoff: 실패할 때마다 두 배 (상한 있음)
+// ============================================
+template <std::uint32_t MinPauses = 1, std::uint32_t MaxPauses = 1024>
+class ExponentialBackoff {
+    static_assert(MinPauses > 0 && MinPauses <= MaxPauses, "Invalid backoff range");
+
+public:
+    void pause() {
+        for (std::uint32_t i = 0; i < limit_; ++i) {
+            SPIN_PAUSE();
+        }
+        // 포화 두 배: MaxPauses가 2^31보다 커도 limit_ * 2가 넘치지 않음
+        limit_ = limit_ > MaxPauses / 2 ? MaxPauses : limit_ * 2;
+    }
+
+    void reset() { limit_ = MinPauses; }
+    bool should_block() const { return false; }
+
+    // 다음 pause()의 pause 횟수
+    std::uint32_t limit() const { return limit_; }
+
+private:
+    std::uint32_t limit_ = MinPauses;
+};
+
+// ============================================
+// JitteredBackoff: 지수 상한 안에서 무작위 대기
+// ============================================
+// 같은 순간 실패한 스레드들이 같은 시간만큼 물러나면
+// 같은 순간 다시 부딪힘 → 무작위로 흩어서 재충돌 방지
+template <std::uint32_t MinPauses = 1, std::uint32_t MaxPauses = 1024>
+class JitteredBackoff {
+    static_assert(MinPauses > 0 && MinPauses <= MaxPauses, "Invalid backoff range");
+
+public:
+    void pause() {
+        // [1, limit_] 범위의 무작위 pause
+        std::uint32_t pauses = 1 + next_random() % limit_;
+        for (std::uint32_t i = 0; i < pauses; ++i) {
+            SPIN_PAUSE();
+        }
+        limit_ = limit_ > MaxPauses / 2 ? MaxPauses : limit_ * 2;
+    }
+
+    void reset() { limit_ = MinPauses; }
+    bool should_block() const { return false; }
+
+    std::uint32_t limit() const { return limit_; }
+
+private:
+    static std::uint32_t next_random() {
+        return detail::thread_random();
+    }
+
+    std::uint32_t limit_ = MinPauses;
+};
+
+// ============================================
+// HybridBackoff: spin → yield → block
+// ============================================
+// SpinLimit번 pause 후 YieldLimit번 yield, 그 다음 should_block() == true
+// → 락은 futex 대기(atomic::wait)로 넘어감
+// 큐처럼 블로킹할 수 없는 곳에서는 계속 yield
+template <std::uint32_t SpinLimit = 32, std::uint32_t YieldLimit = 0>
+class HybridBackoff {
+public:
+    void pause() {
+        if (count_ < SpinLimit) {
+            SPIN_PAUSE();
+        } else {
+            std::this_thread::yield();
+        }
+        ++count_;
+    }
+
+    void reset() { count_ = 0; }
+    bool should_block() const { return count_ >= SpinLimit + YieldLimit; }
+
+private:
+    std::uint32_t count_ = 0;
+};
+
+/**
+ * 락별 상태를 가진 Backoff 정책 요구사항
+ *
+ * - state_type:    락 객체 안에 하나씩 두는 공유 상태
+ * - B(state):      그 상태로부터 이번 스핀 예산을 정함
+ * - on_acquired(): 락 획득 직후 (락을 쥔 채로) 호출 → 상태 갱신
+ */
+template <typename B>
+concept StatefulBackoffPolicy = BackoffPolicy<B> && requires(typename B::state_type& s, B& b) {
+    B(s);
+    b.on_acquired();
+};
+
+// ============================================
+// AdaptiveBackoff: 락별로 스핀 횟수를 학습 (glibc adaptive mutex)
+// ============================================
+// 고정 스핀 횟수의 문제:
+//   - 임계 구역이 짧은 락: 32번으로는 모자라 불필요하게 futex로 잠듦
+//   - 임계 구역이 긴 락:   어차피 못 얻을 걸 32번 헛돌고 잠듦
+//
+// glibc PTHREAD_MUTEX_ADAPTIVE_NP와 같은 방식:
+//   예산 = min(MaxSpins, 2 * 추정치 + MinSpins)
+//   스핀으로 얻음:  추정치 += (실제 스핀 - 추정치) / 8   (이동 평균)
+//   예산 소진:      추정치 -= 추정치 / 8                 (스핀이 안 통함)
+//
+// glibc는 예산을 다 써도 추정치를 "올리지만", 여기서는 내림
+// → 오래 잡히는 락은 추정치가 0으로 수렴 → 거의 곧바로 futex 대기
+// → MinSpins 만큼은 항상 스핀하므로 락이 다시 짧아지면 재학습
+struct AdaptiveSpinState {
+    // 추정 스핀 횟수 × 8 (고정소수점 3비트 → 1/8 이동 평균에서 정밀도 유지)
+    // 락을 쥔 스레드만 쓰고 대기자는 읽기만 함 → relaxed load/store로 충분
+    std::atomic<std::uint32_t> scaled_estimate{0};
+
+    // 현재 추정치 (스핀 횟수)
+    std::uint32_t spins() const {
+        return scaled_estimate.load(std::memory_order_relaxed) / 8;
+    }
+};
+
+template <std::uint32_t MinSpins = 10, std::uint32_t MaxSpins = 100>
+class AdaptiveBackoff {
+    static_assert(MinSpins <= MaxSpins, "Invalid spin range");
+
+public:
+    using state_type = AdaptiveSpinState;
+
+    // 상태 없이 생성하면 MaxSpins 고정 예산 (큐 등에서 사용 시)
+    AdaptiveBackoff() = default;
+
+    explicit AdaptiveBackoff(state_type& state)
+        : state_(&state),
+          limit_(std::min(MaxSpins, 2 * state.spins() + MinSpins)) {}
+
+    void pause() {
+        SPIN_PAUSE();
+        ++count_;
+    }
+
+    void reset() { count_ = 0; }
+    bool should_block() const { return count_ >= limit_; }
+
+    void on_acquired() {
+        if (state_ == nullptr) {
+            return;
+        }
+        std::uint32_t scaled = state_->scaled_estimate.load(std::memory_order_relaxed);
+        std::uint32_t next;
+        if (should_block()) {
+            next = scaled - scaled / 8;                 // 스핀 실패 → 감소
+        } else {
+            next = scaled - scaled / 8 + count_;        // est += (count - est) / 8
+        }
+        if (next != scaled) {
+            // 방금 exchange로 얻은 락과 같은 캐시라인 → 추가 전송 없음
+            state_->scaled_estimate.store(next, std::memory_order_relaxed);
+        }
+    }
+
+    // 이번 획득 시도의 스핀 예산
+    std::uint32_t limit() const { return limit_; }
+
+private:
+    state_type* state_ = nullptr;
+    std::uint32_t limit_ = MaxSpins;
+    std::uint32_t count_ = 0;
+};
+
+static_assert(BackoffPolicy<NoBackoff>);
+static_assert(BackoffPolicy<ConstantBackoff<>>);
+static_assert(BackoffPolicy<ExponentialBackoff<>>);
+static_assert(BackoffPolicy<JitteredBackoff<>>);
+static_assert(BackoffPolicy<HybridBackoff<>>);
+static_assert(StatefulBackoffPolicy<AdaptiveBackoff<>>);
+static_assert(!StatefulBackoffPolicy<HybridBackoff<>>);
+
+} // namespace lockfree
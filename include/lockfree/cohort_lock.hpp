@@ -0,0 +1,214 @@
+/**
+ * Cohort Lock - NUMA-Aware Hierarchical Lock (Dice, Marathe & Shavit)
+ *
+ * SpinLock/TicketLock을 2-소켓 머신에서 쓰면
+ *   소켓 0의 스레드 → 소켓 1의 스레드 → 소켓 0 ... 으로 소유권이 오감
+ *   → 락 캐시라인 + 임계 구역이 만지는 데이터까지 매번 인터커넥트를 건넘
+ *
+ * Cohort Lock 핵심 아이디어:
+ *   노드(소켓)마다 로컬 락 + 전체에 글로벌 락 하나
+ *   같은 노드에 대기자가 있으면 글로벌 락은 쥔 채로 로컬 락만 넘김
+ *   → 소유권이 한 노드 안에서 연속으로 돎 (cohort = 같은 노드 대기자 무리)
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │                    global_ (TicketLock)                      │
+ * │                    ▲                 ▲                       │
+ * │     ┌──────────────┴──┐       ┌──────┴──────────┐            │
+ * │     │ node 0 local    │       │ node 1 local    │            │
+ * │     │ owns_global = 1 │       │ owns_global = 0 │            │
+ * │     │ A(holder) B C   │       │ D E             │            │
+ * │     └─────────────────┘       └─────────────────┘            │
+ * │                                                              │
+ * │  A.unlock(): 로컬 대기자 B가 있음 → 로컬 락만 B에게           │
+ * │              (글로벌 락은 node 0이 계속 보유)                 │
+ * │  batch_limit번 넘긴 뒤에는 글로벌 락도 풀어서 node 1에 기회    │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * 요구 조건:
+ *   - 글로벌 락은 thread-oblivious 해야 함
+ *     (A가 잡은 글로벌 락을 B가 풀 수 있어야 함) → TicketLock
+ *   - 로컬 락은 "대기자가 있는지" 알려줘야 함 → TicketLock::waiting_count()
+ *
+ * batch_limit: 한 노드가 글로벌 락을 연속으로 쥘 수 있는 최대 획득 횟수
+ *   클수록 처리량↑, 다른 노드의 대기 시간(공정성)↓
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+
+#include "numa_topology.hpp"
+#include "ticket_lock.hpp"
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lockfree {
+
+class CohortLock {
+public:
+    static constexpr std::uint32_t DEFAULT_BATCH_LIMIT = 64;
+
+    /**
+     * 감지된 NUMA 노드 수로 생성 (단일 노드 머신에서는 TicketLock + 약간의 비용)
+     */
+    explicit CohortLock(std::uint32_t batch_limit = DEFAULT_BATCH_LIMIT)
+        : CohortLock(NumaTopology::instance().node_count(), batch_limit) {}
+
+    /**
+     * 노드 수를 직접 지정 (테스트, 또는 lock(node)로 그룹을 직접 나눌 때)
+     */
+    CohortLock(std::uint32_t node_count, std::uint32_t batch_limit)
+        : node_count_(node_count > 0 ? node_count : 1),
+          batch_limit_(batch_limit > 0 ? batch_limit : 1),
+          cohorts_(std::make_unique<Cohort[]>(node_count_)) {}
+
+    // Non-copyable, non-movable
+    CohortLock(const CohortLock&) = delete;
+    CohortLock& operator=(const CohortLock&) = delete;
+    CohortLock(CohortLock&&) = delete;
+    CohortLock& operator=(CohortLock&&) = delete;
+
+    // ============================================
+    // Lock API
+    // ============================================
+
+    /**
+     * 호출 스레드가 도는 노드의 cohort로 획득
+     */
+    void lock() {
+        lock(current_node());
+    }
+
+    /**
+     * 지정한 노드의 cohort로 획득
+     *
+     * @param node 0..node_count()-1 (범위를 넘으면 나머지 연산)
+     */
+    void lock(std::uint32_t node) {
+        node %= node_count_;
+        Cohort& cohort = cohorts_[node];
+
+        cohort.local.lock();
+
+        // 로컬 락을 쥔 스레드만 owns_global/batch를 만짐 → 일반 변수로 충분
+        // (로컬 락의 release/acquire가 이전 보유자의 쓰기를 보여줌)
+        if (!cohort.owns_global) {
+            global_.lock();
+            cohort.owns_global = true;
+            cohort.batch = 0;
+        }
+        owner_node_ = node;
+    }
+
+    bool try_lock() {
+        std::uint32_t node = current_node() % node_count_;
+        Cohort& cohort = cohorts_[node];
+
+        if (!cohort.local.try_lock()) {
+            return false;
+        }
+        if (!cohort.owns_global) {
+            if (!global_.try_lock()) {
+                cohort.local.unlock();
+                return false;
+            }
+            cohort.owns_global = true;
+            cohort.batch = 0;
+        }
+        owner_node_ = node;
+        return true;
+    }
+
+    void unlock() {
+        // 스레드가 그 사이 다른 CPU로 옮겨졌어도 lock() 때의 노드로 해제
+        Cohort& cohort = cohorts_[owner_node_];
+        assert(cohort.owns_global && "CohortLock::unlock() without lock()");
+
+        // 같은 노드에 대기자가 있고 배치 한도 전이면 글로벌 락은 그대로 넘김
+        if (++cohort.batch < batch_limit_ && cohort.local.waiting_count() > 0) {
+            cohort.local.unlock();
+            return;
+        }
+
+        // 글로벌 락 해제 → 다른 노드에 기회
+        cohort.owns_global = false;
+        cohort.batch = 0;
+        global_.unlock();
+        cohort.local.unlock();
+    }
+
+    std::uint32_t node_count() const {
+        return node_count_;
+    }
+
+    std::uint32_t batch_limit() const {
+        return batch_limit_;
+    }
+
+private:
+    std::uint32_t current_node() const {
+        return node_count_ == 1 ? 0 : NumaTopology::instance().current_node();
+    }
+
+    /**
+     * 노드별 상태
+     *
+     * 각 cohort는 자기 캐시라인에 → 다른 노드의 로컬 락과 false sharing 없음
+     * (해당 노드 스레드들만 만지므로 캐시라인이 노드 밖으로 나가지 않음)
+     */
+    struct alignas(64) Cohort {
+        TicketLock local;
+
+        // 이 노드가 글로벌 락을 쥐고 있는지 (로컬 락 보유자만 접근)
+        bool owns_global = false;
+
+        // 글로벌 락을 쥔 뒤 노드 안에서 넘겨준 횟수
+        std::uint32_t batch = 0;
+    };
+
+private:
+    const std::uint32_t node_count_;
+    const std::uint32_t batch_limit_;
+    std::unique_ptr<Cohort[]> cohorts_;
+
+    // 노드 사이에서만 오가는 락 (cohort 단위로 한 번씩)
+    TicketLock global_;
+
+    // 현재 보유자가 잡은 노드 (락 보유자만 접근)
+    std::uint32_t owner_node_ = 0;
+};
+
+// ============================================
+// RAII wrapper for CohortLock
+// ============================================
+class CohortLockGuard {
+public:
+    explicit CohortLockGuard(CohortLock& lock) : lock_(lock) {
+        lock_.lock();
+    }
+
+    ~CohortLockGuard() {
+        lock_.unlock();
+    }
+
+    // Non-copyable, non-movable
+    CohortLockGuard(const CohortLockGuard&) = delete;
+    CohortLockGuard& operator=(const CohortLockGuard&) = delete;
+    CohortLockGuard(CohortLockGuard&&) = delete;
+    CohortLockGuard& operator=(CohortLockGuard&&) = delete;
+
+private:
+    CohortLock& lock_;
+};
+
+} // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,287 @@
+/**
+ * Elimination Backoff Stack - Hendler, Shavit, Yerushalmi, 2004
+ *
+ * ABASafeStack의 한계:
+ *   모든 push/pop이 head_ 하나를 CAS → 스레드를 늘려도 처리량이 평평
+ *
+ * 핵심 관찰:
+ *   동시에 도착한 push(x)와 pop()은 서로 상쇄 가능
+ *   → push가 x를 넣고 pop이 바로 x를 꺼낸 것과 같음 (선형화 가능)
+ *   → head_를 건드리지 않고 둘이 직접 값을 주고받으면 됨
+ *
+ * ┌────────────────────────────────────────────────────────────┐
+ * │  ABASafeStack head_   ← 먼저 CAS 한 번 시도                  │
+ * │       │ 실패 (경합)                                          │
+ * │       ▼                                                     │
+ * │  EliminationArray  [slot0][slot1][slot2][slot3] ... [MAX-1] │
+ * │                     └──── width_ ────┘                       │
+ * │    push: 빈 슬롯에 노드를 걸고 잠시 대기                       │
+ * │          → pop이 가져가면 완료, 아니면 회수 후 head_ 재시도    │
+ * │    pop:  노드가 걸린 슬롯을 찾으면 CAS로 가져감 → 완료         │
+ * └────────────────────────────────────────────────────────────┘
+ *
+ * 적응형 폭 (width_):
+ *   - 슬롯을 차지하려다 부딪힘 (경합 높음) → 폭 2배 (만날 곳을 넓힘)
+ *   - 상대를 못 만나고 시간 초과 (경합 낮음) → 폭 절반 (만날 확률을 높임)
+ *   → 스레드가 적을 때는 슬롯 1~2개, 많을 때는 전체를 씀
+ *
+ * ABA:
+ *   슬롯도 AtomicTaggedPtr → 같은 노드 주소가 재사용돼도
+ *   push의 회수 CAS는 자기가 건 (노드, 태그)일 때만 성공
+ *
+ * 소거된 노드는 스택에 들어간 적이 없음 → 다른 스레드가 읽을 수 없으므로
+ * retire 없이 pop한 스레드가 바로 해제
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include "aba_safe_stack.hpp"
+#include "backoff.hpp"
+#include "tagged_ptr.hpp"
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lockfree {
+
+/**
+ * 소거 배열 (push 노드 ↔ pop 교환 장소)
+ *
+ * @tparam Node     교환할 노드 타입
+ * @tparam MaxSlots 최대 슬롯 수 (2의 거듭제곱)
+ */
+template <typename Node, std::size_t MaxSlots = 16>
+class EliminationArray {
+    static_assert(MaxSlots > 0 && (MaxSlots & (MaxSlots - 1)) == 0,
+                  "MaxSlots must be a power of 2");
+
+public:
+    // 상대를 기다리는 pause 횟수 (짧게: 못 만나면 head_로 돌아가는 편이 나음)
+    static constexpr std::uint32_t DEFAULT_SPINS = 128;
+
+    EliminationArray() = default;
+
+    // Non-copyable, non-movable
+    EliminationArray(const EliminationArray&) = delete;
+    EliminationArray& operator=(const EliminationArray&) = delete;
+    EliminationArray(EliminationArray&&) = delete;
+    EliminationArray& operator=(EliminationArray&&) = delete;
+
+    /**
+     * push 쪽: 노드를 슬롯에 걸고 pop이 가져가길 기다림
+     *
+     * @return true  = pop이 가져감 (노드 소유권이 넘어감)
+     *         false = 만나지 못함 (노드는 호출자에게 그대로)
+     */
+    bool offer(Node* node, std::uint32_t spins = DEFAULT_SPINS) {
+        Slot& slot = pick_slot();
+        TaggedPtr<Node> current = slot.item.load(std::memory_order_relaxed);
+        if (current.ptr() != nullptr) {
+            grow();  // 다른 push가 이미 기다리는 중 → 폭이 좁음
+            return false;
+        }
+
+        // release: pop이 노드 내용을 보도록
+        TaggedPtr<Node> offered = current.advanced(node);
+        if (!slot.item.compare_exchange_strong(
+                current, offered,
+                std::memory_order_release,
+                std::memory_order_relaxed)) {
+            grow();
+            return false;
+        }
+
+        for (std::uint32_t i = 0; i < spins; ++i) {
+            if (slot.item.load(std::memory_order_relaxed) != offered) {
+                return true;  // pop이 가져감 (태그가 바뀜)
+            }
+            SPIN_PAUSE();
+        }
+
+        // 시간 초과 → 회수 (그 사이 가져갔으면 CAS 실패 = 교환 성공)
+        if (slot.item.compare_exchange_strong(
+                offered, offered.advanced(nullptr),
+                std::memory_order_relaxed,
+                std::memory_order_relaxed)) {
+            shrink();
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * pop 쪽: 슬롯에 걸린 노드를 가져옴
+     *
+     * @return 가져온 노드 (소유권 포함), 만나지 못했으면 nullptr
+     */
+    Node* take(std::uint32_t spins = DEFAULT_SPINS) {
+        Slot& slot = pick_slot();
+        for (std::uint32_t i = 0; i < spins; ++i) {
+            TaggedPtr<Node> current = slot.item.load(std::memory_order_relaxed);
+            if (current.ptr() != nullptr) {
+                // acquire: push가 채운 노드 내용과 짝
+                if (slot.item.compare_exchange_strong(
+                        current, current.advanced(nullptr),
+                        std::memory_order_acquire,
+                        std::memory_order_relaxed)) {
+                    slot.eliminated.fetch_add(1, std::memory_order_relaxed);
+                    return current.ptr();
+                }
+                grow();  // 다른 pop이 먼저 가져감
+                return nullptr;
+            }
+            SPIN_PAUSE();
+        }
+        shrink();
+        return nullptr;
+    }
+
+    /**
+     * 현재 사용하는 슬롯 수
+     */
+    std::size_t width() const {
+        return width_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * 지금까지 성사된 교환 수 (슬롯별 카운터 합, 근사값)
+     */
+    std::size_t elimination_count() const {
+        std::size_t total = 0;
+        for (const Slot& slot : slots_) {
+            total += slot.eliminated.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+private:
+    // 슬롯마다 캐시라인 분리 (서로 다른 슬롯의 교환이 간섭하지 않음)
+    // 카운터는 교환하는 두 스레드가 이미 만지는 줄에 둠 → 공유 카운터 경합 없음
+    struct alignas(64) Slot {
+        AtomicTaggedPtr<Node> item;
+        std::atomic<std::size_t> eliminated{0};
+    };
+
+    Slot& pick_slot() {
+        std::size_t width = width_.load(std::memory_order_relaxed);
+        return slots_[detail::thread_random() & (width - 1)];
+    }
+
+    // 폭 조정은 경쟁해도 무방 (어느 값이든 유효한 폭)
+    void grow() {
+        std::size_t width = width_.load(std::memory_order_relaxed);
+        if (width < MaxSlots) {
+            width_.store(width * 2, std::memory_order_relaxed);
+        }
+    }
+
+    void shrink() {
+        std::size_t width = width_.load(std::memory_order_relaxed);
+        if (width > 1) {
+            width_.store(width / 2, std::memory_order_relaxed);
+        }
+    }
+
+    Slot slots_[MaxSlots];
+    alignas(64) std::atomic<std::size_t> width_{1};
+};
+
+/**
+ * Elimination Backoff Stack
+ *
+ * ABASafeStack + 소거 배열: head_ CAS가 실패했을 때만 소거를 시도
+ * → 경합이 없으면 ABASafeStack과 같은 경로
+ *
+ * @tparam Reclaimer 노드 해제 정책 (ABASafeStack과 동일)
+ * @tparam MaxSlots  소거 배열 최대 슬롯 수
+ */
+template <typename T, typename Reclaimer = HazardPointerReclaimer, std::size_t MaxSlots = 16>
+class EliminationBackoffStack {
+    using Stack = ABASafeStack<T, Reclaimer>;
+    using Node = typename Stack::Node;
+
+public:
+    EliminationBackoffStack() = default;
+
+    // 복사/이동 금지
+    EliminationBackoffStack(const EliminationBackoffStack&) = delete;
+    EliminationBackoffStack& operator=(const EliminationBackoffStack&) = delete;
+    EliminationBackoffStack(EliminationBackoffStack&&) = delete;
+    EliminationBackoffStack& operator=(EliminationBackoffStack&&) = delete;
+
+    void push(const T& value) {
+        push_node(stack_.create_node(value));
+    }
+
+    void push(T&& value) {
+        push_node(stack_.create_node(std::move(value)));
+    }
+
+    /**
+     * @return 제거된 값 (스택이 비었으면 nullopt)
+     */
+    std::optional<T> pop() {
+        std::optional<T> result;
+        while (!stack_.try_pop(result)) {
+            // head_ 경합 → 기다리는 push가 있으면 그 값을 바로 받음
+            if (Node* node = elimination_.take()) {
+                result.emplace(std::move(node->data));
+                stack_.destroy_node(node);  // 스택에 들어간 적 없음 → retire 불필요
+                return result;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * 스택이 비어있는지 확인 (슬롯에 걸린 push는 세지 않음)
+     */
+    bool empty() const {
+        return stack_.empty();
+    }
+
+    /**
+     * 소거로 처리된 push/pop 쌍의 수
+     */
+    std::size_t elimination_count() const {
+        return elimination_.elimination_count();
+    }
+
+    /**
+     * 현재 소거 배열 폭
+     */
+    std::size_t elimination_width() const {
+        return elimination_.width();
+    }
+
+    static bool is_lock_free() {
+        return Stack::is_lock_free();
+    }
+
+private:
+    void push_node(Node* node) {
+        while (!stack_.try_push_node(node)) {
+            if (elimination_.offer(node)) {
+                return;  // pop이 가져감
+            }
+        }
+    }
+
+    Stack stack_;
+    EliminationArray<Node, MaxSlots> elimination_;
+};
+
+} // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,316 @@
+/**
+ * Epoch-Based Reclamation (EBR) - Fraser, 2004
+ *
+ * Hazard pointer의 비용:
+ *   protect()마다 seq_cst fence → 읽기 위주 순회에서는 노드마다 fence
+ *
+ * EBR 핵심 아이디어:
+ *   "노드 하나"가 아니라 "임계 구역 전체"를 보호
+ *   - 진입 시 현재 전역 epoch를 게시 (pin), 나갈 때 해제 (unpin)
+ *   - 구역 안에서는 평범한 acquire load만으로 노드를 읽음
+ *   - retire된 노드는 그 epoch의 limbo 목록에 보관
+ *   - 모든 pin된 스레드가 현재 epoch에 도달해야 전역 epoch가 전진
+ *   - 두 번 전진한 epoch의 limbo는 아무도 볼 수 없음 → 묶음 해제
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  global_epoch_ = E                                           │
+ * │                                                              │
+ * │  records_  [E|pinned] [idle] [E-1|pinned]  ← 각자 캐시라인     │
+ * │                                  └─ 뒤처진 스레드 → 전진 불가   │
+ * │                                                              │
+ * │  limbo_[E % 3]     ← 지금 retire되는 노드                      │
+ * │  limbo_[(E-1) % 3] ← E-1 pin 스레드가 아직 볼 수 있음           │
+ * │  limbo_[(E-2) % 3] ← 아무도 못 봄 → E+1로 전진할 때 해제        │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * 왜 3개인가:
+ *   E로 전진했다 = 모든 pin된 스레드가 E-1 이상에서 들어옴
+ *   E-2 이전에 retire된 노드는 retire 전에 이미 unlink됨
+ *   → E-1 이상에서 들어온 스레드는 그 노드에 도달할 수 없음
+ *
+ * 단점:
+ *   pin한 채 멈춘 스레드 하나가 전진을 막음 → 해제 대기 노드가 무한히 쌓임
+ *   (hazard pointer는 보호 중인 노드만 남으므로 상한이 있음)
+ *
+ * 사용 방법 (침습적 노드):
+ *   struct Node : EpochNode { ... };
+ *   EpochDomain domain(&reclaim_nodes, context);
+ *
+ *   EpochGuard guard(domain);      // pin
+ *   Node* n = head_.load(acquire); // fence 없음
+ *   ... CAS로 n을 구조에서 제거 ...
+ *   domain.retire(n);              // 두 epoch 뒤 reclaim_nodes(..., context)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "reclamation.hpp"
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lockfree {
+
+/**
+ * retire될 노드의 기반 클래스
+ *
+ * limbo 목록 링크를 노드 안에 둠 → retire가 메모리를 할당하지 않음
+ */
+struct EpochNode {
+    EpochNode* ebr_retired_next = nullptr;
+};
+
+class EpochDomain {
+public:
+    /**
+     * 안전해진 노드 묶음을 돌려주는 함수 (delete, pool.destroy_bulk 등)
+     */
+    using Reclaimer = detail::ReclaimBatch<EpochNode>::Reclaimer;
+
+    // retire가 이만큼 쌓일 때마다 epoch 전진 시도
+    static constexpr std::size_t ADVANCE_THRESHOLD = 64;
+
+    explicit EpochDomain(Reclaimer reclaim, void* context = nullptr)
+        : reclaim_(reclaim),
+          context_(context) {}
+
+    /**
+     * 소멸 시점에는 사용 중인 스레드가 없어야 함 → limbo 전부 해제
+     */
+    ~EpochDomain() {
+        reclaim_all();
+    }
+
+    // Non-copyable, non-movable
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+    EpochDomain(EpochDomain&&) = delete;
+    EpochDomain& operator=(EpochDomain&&) = delete;
+
+    /**
+     * 구조에서 제거된 노드를 해제 예약
+     *
+     * 호출 시점에 node는 이미 구조에서 unlink되어 있어야 함
+     * pin 중이든 아니든 호출 가능
+     */
+    void retire(EpochNode* node) {
+        // unlink(호출자의 CAS) → epoch 읽기 순서 보장
+        // 늦게 읽은 epoch는 실제보다 크거나 같음 → 해제가 늦어질 뿐 안전
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::uint64_t epoch = global_epoch_.load(std::memory_order_relaxed);
+
+        LimboBag& bag = limbo_[epoch % LIMBO_BAGS];
+        EpochNode* head = bag.head.load(std::memory_order_relaxed);
+        do {
+            node->ebr_retired_next = head;
+        } while (!bag.head.compare_exchange_weak(
+            head, node,
+            std::memory_order_release,
+            std::memory_order_relaxed));
+        retired_count_.fetch_add(1, std::memory_order_relaxed);
+
+        if (pending_.fetch_add(1, std::memory_order_relaxed) + 1 >= ADVANCE_THRESHOLD) {
+            pending_.store(0, std::memory_order_relaxed);
+            try_advance();
+        }
+    }
+
+    /**
+     * 모든 pin된 스레드가 현재 epoch에 있으면 전진하고
+     * 두 epoch 전의 limbo를 묶음으로 해제
+     *
+     * @return 이 호출이 epoch를 전진시켰으면 true
+     */
+    bool try_advance() {
+        std::uint64_t epoch = global_epoch_.load(std::memory_order_relaxed);
+
+        // pin 게시(EpochGuard의 store + fence)와 짝을 이룸
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        for (EpochRecord* rec = records_.head(); rec != nullptr; rec = rec->next) {
+            std::uint64_t state = rec->state.load(std::memory_order_relaxed);
+            if ((state & PINNED) != 0 && (state >> 1) != epoch) {
+                return false;  // 이전 epoch에 머문 스레드가 있음
+            }
+        }
+
+        if (!global_epoch_.compare_exchange_strong(
+                epoch, epoch + 1,
+                std::memory_order_acq_rel,
+                std::memory_order_relaxed)) {
+            return false;  // 다른 스레드가 먼저 전진 (해제도 그쪽에서)
+        }
+
+        // 새 epoch = epoch + 1 → epoch - 1 이전의 limbo는 안전
+        reclaim_bag(limbo_[(epoch + 2) % LIMBO_BAGS]);
+        return true;
+    }
+
+    /**
+     * 모든 limbo 노드를 강제 해제
+     *
+     * 다른 스레드가 이 도메인을 쓰고 있지 않을 때만 (소멸자, 테스트)
+     */
+    void reclaim_all() {
+        for (LimboBag& bag : limbo_) {
+            reclaim_bag(bag);
+        }
+    }
+
+    /**
+     * 현재 전역 epoch
+     */
+    std::uint64_t epoch() const {
+        return global_epoch_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * 해제 대기 중인 노드 수 (근사값)
+     */
+    std::size_t retired_count() const {
+        return retired_count_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * 지금까지 만들어진 epoch record 수 (= 동시에 쓰인 EpochGuard 최대 수)
+     */
+    std::size_t record_count() const {
+        return records_.size();
+    }
+
+private:
+    friend class EpochGuard;
+
+    static constexpr std::size_t LIMBO_BAGS = 3;
+    static constexpr std::uint64_t PINNED = 1;
+
+    /**
+     * Epoch record: 스레드 하나의 게시 슬롯
+     *
+     * state = (pin한 epoch << 1) | PINNED, 0 = 임계 구역 밖
+     * 스레드마다 자기 캐시라인에만 씀 → pin/unpin이 서로 간섭하지 않음
+     */
+    struct alignas(64) EpochRecord {
+        std::atomic<std::uint64_t> state{0};
+        std::atomic<bool> active{false};
+        EpochRecord* next = nullptr;  // push 후 불변
+    };
+
+    // 세 limbo 목록은 각자 캐시라인 (retire와 해제가 서로 다른 bag을 만짐)
+    struct alignas(64) LimboBag {
+        std::atomic<EpochNode*> head{nullptr};
+    };
+
+    EpochRecord* pin() {
+        EpochRecord* rec = records_.acquire();
+        std::uint64_t epoch = global_epoch_.load(std::memory_order_relaxed);
+        rec->state.store((epoch << 1) | PINNED, std::memory_order_relaxed);
+
+        // 게시가 이후 구조 읽기보다 먼저 보이도록 (pin당 한 번, 읽기마다가 아님)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return rec;
+    }
+
+    static void unpin(EpochRecord* rec) {
+        // release: 구역 안의 읽기가 끝난 뒤에 해제가 보임
+        rec->state.store(0, std::memory_order_release);
+        detail::RecordRegistry<EpochRecord>::release(rec);
+    }
+
+    void reclaim_bag(LimboBag& bag) {
+        EpochNode* list = bag.head.exchange(nullptr, std::memory_order_acquire);
+        if (list == nullptr) {
+            return;
+        }
+
+        std::size_t reclaimed = 0;
+        detail::ReclaimBatch<EpochNode> batch(reclaim_, context_);
+        while (list != nullptr) {
+            EpochNode* next = list->ebr_retired_next;
+            batch.add(list);
+            ++reclaimed;
+            list = next;
+        }
+        batch.flush();
+        retired_count_.fetch_sub(reclaimed, std::memory_order_relaxed);
+    }
+
+private:
+    // 모든 pin이 읽는 값 → 자주 쓰이는 limbo/카운터와 분리
+    alignas(64) std::atomic<std::uint64_t> global_epoch_{0};
+
+    detail::RecordRegistry<EpochRecord> records_;
+
+    LimboBag limbo_[LIMBO_BAGS];
+
+    alignas(64) std::atomic<std::size_t> retired_count_{0};
+    std::atomic<std::size_t> pending_{0};  // 마지막 전진 시도 이후 retire 수
+
+    const Reclaimer reclaim_;
+    void* const context_;
+};
+
+// ============================================
+// EpochGuard: RAII 임계 구역 (pin ~ unpin)
+// ============================================
+// 살아 있는 동안 읽은 노드는 해제되지 않음 (몇 개를 읽든)
+// HazardPointer와 같은 인터페이스 → Reclaimer 정책으로 교체 가능
+class EpochGuard {
+public:
+    explicit EpochGuard(EpochDomain& domain)
+        : record_(domain.pin()) {}
+
+    ~EpochGuard() {
+        EpochDomain::unpin(record_);
+    }
+
+    // Non-copyable, non-movable
+    EpochGuard(const EpochGuard&) = delete;
+    EpochGuard& operator=(const EpochGuard&) = delete;
+    EpochGuard(EpochGuard&&) = delete;
+    EpochGuard& operator=(EpochGuard&&) = delete;
+
+    /**
+     * 보호는 pin이 이미 하고 있음 → 평범한 acquire load
+     */
+    template <typename T>
+    T* protect(const std::atomic<T*>& src) {
+        return src.load(std::memory_order_acquire);
+    }
+
+    template <typename Atomic, typename F>
+    auto protect(const Atomic& src, F&& /*to_ptr*/) {
+        return src.load(std::memory_order_acquire);
+    }
+
+    /**
+     * HazardPointer 인터페이스 호환용 (할 일 없음)
+     */
+    void reset_protection(const void* /*ptr*/ = nullptr) {}
+
+private:
+    EpochDomain::EpochRecord* record_;
+};
+
+// ============================================
+// 자료구조용 Reclaimer 정책 (hazard_pointer.hpp 참고)
+// ============================================
+// 예: ABASafeStack<T, EpochReclaimer>
+struct EpochReclaimer {
+    using node_base = EpochNode;
+    using domain_type = EpochDomain;
+    using guard_type = EpochGuard;
+};
+
+} // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,291 @@
+/**
+ * Flat Combining - 순차 자료구조를 경합 속에서 빠르게 (Hendler, Incze, Shavit, Tzafrir)
+ *
+ * 오더북, LRU 같은 구조는 lock-free로 만들기 어려움 → SpinLock으로 감쌈
+ * 그런데 경합이 생기면:
+ *   - 락 캐시라인이 스레드마다 오감
+ *   - 자료구조의 캐시라인(노드, 버킷)도 보유자마다 오감
+ *   → 연산 하나에 캐시라인 전송 여러 번
+ *
+ * Flat Combining 핵심 아이디어:
+ *   각 스레드는 "할 일"을 자기 슬롯에 적어두기만 함 (publication record)
+ *   락을 얻은 한 스레드(combiner)가 모든 슬롯의 일을 한꺼번에 실행
+ *   → 자료구조는 combiner의 캐시에만 머묾 (지역성↑)
+ *   → 락 획득 한 번에 여러 연산 처리 (전송 비용 분할 상환)
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  slot[0]     slot[1]     slot[2]     ...     ← 각자 캐시라인  │
+ * │  PENDING     EMPTY       PENDING                             │
+ * │  push(3)                 pop()                               │
+ * │     │                       │                                │
+ * │     └───────────┬───────────┘                                │
+ * │                 ▼                                            │
+ * │  combiner (combiner_lock_ 보유): 순서대로 실행 → DONE 표시     │
+ * │  나머지 스레드: 자기 슬롯이 DONE이 될 때까지 슬롯만 스핀       │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * 사용 예:
+ *   FlatCombiner<std::map<int, int>> book;
+ *   book.apply([](auto& m) { m[price] += qty; });
+ *   auto best = book.apply([](auto& m) { return m.begin()->first; });
+ *
+ * 주의: 연산은 다른 스레드(combiner)에서 실행될 수 있음
+ *       → thread_local에 의존하는 연산은 넣지 말 것
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "spinlock.hpp"
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lockfree {
+
+/**
+ * FlatCombiner
+ *
+ * @tparam DS    감쌀 순차 자료구조 (combiner만 접근)
+ * @tparam Slots publication record 수 (2의 거듭제곱)
+ *               동시에 apply 중인 스레드가 이보다 많으면 빈 슬롯을 기다림
+ */
+template <typename DS, std::size_t Slots = 64>
+class FlatCombiner {
+    static_assert(Slots > 0 && (Slots & (Slots - 1)) == 0, "Slots must be a power of 2");
+
+public:
+    template <typename... Args>
+    explicit FlatCombiner(Args&&... args) : ds_(std::forward<Args>(args)...) {}
+
+    // Non-copyable, non-movable
+    FlatCombiner(const FlatCombiner&) = delete;
+    FlatCombiner& operator=(const FlatCombiner&) = delete;
+    FlatCombiner(FlatCombiner&&) = delete;
+    FlatCombiner& operator=(FlatCombiner&&) = delete;
+
+    /**
+     * 자료구조에 연산 적용
+     *
+     * @param func R(DS&) - combiner가 다른 연산들과 함께 순차 실행
+     * @return func의 반환값 (예외도 호출자에게 그대로 전달)
+     *         참조 반환(T&, T&&)도 가능 - 다만 참조한 대상을 쓰는 시점에는
+     *         combiner 밖이므로 호출자가 따로 동기화해야 함
+     */
+    template <typename F>
+    std::invoke_result_t<F&, DS&> apply(F&& func) {
+        using R = std::invoke_result_t<F&, DS&>;
+
+        Operation<F, R> op(func);
+        Record& record = claim_record();
+
+        // 1. 슬롯에 연산 게시
+        record.invoke = &Operation<F, R>::run;
+        record.context = &op;
+        // release: invoke/context 쓰기가 PENDING과 함께 combiner에게 보임
+        record.state.store(PENDING, std::memory_order_release);
+
+        // 2. 내 슬롯이 끝날 때까지: combiner가 될 수 있으면 직접 combine
+        std::uint32_t spins = 0;
+        while (record.state.load(std::memory_order_acquire) != DONE) {
+            // TTAS: 잡혀 있으면 try_lock(쓰기)하지 않음
+            if (!combiner_lock_.is_locked() && combiner_lock_.try_lock()) {
+                combine();
+                combiner_lock_.unlock();
+                continue;  // 내 연산도 방금 실행됨
+            }
+            if (++spins < spin_count_) {
+                SPIN_PAUSE();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+
+        // 3. 슬롯 반납 (결과는 내 스택의 op에 있음)
+        record.state.store(EMPTY, std::memory_order_release);
+
+        if (op.error) {
+            std::rethrow_exception(op.error);
+        }
+        if constexpr (std::is_reference_v<R>) {
+            return static_cast<R>(*op.result);
+        } else if constexpr (!std::is_void_v<R>) {
+            return std::move(*op.result);
+        }
+    }
+
+    /**
+     * combiner가 실행한 연산 수와 combine 횟수 (튜닝용, 근사값)
+     *
+     * combined_operations() / combine_count() = 락 획득당 평균 배치 크기
+     */
+    std::uint64_t combined_operations() const {
+        return combined_operations_.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t combine_count() const {
+        return combine_count_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr std::uint32_t EMPTY = 0;    // 비어 있음
+    static constexpr std::uint32_t CLAIMED = 1;  // 스레드가 차지, 게시 전
+    static constexpr std::uint32_t PENDING = 2;  // 게시됨, combiner 대기
+    static constexpr std::uint32_t DONE = 3;     // 실행 완료
+
+    /**
+     * Publication record
+     *
+     * 각 슬롯은 자기 캐시라인에 → 게시하는 스레드끼리 false sharing 없음
+     */
+    struct alignas(64) Record {
+        std::atomic<std::uint32_t> state{EMPTY};
+        void (*invoke)(DS&, void*) = nullptr;
+        void* context = nullptr;
+    };
+
+    /**
+     * 결과 저장소 타입
+     *
+     * void → 자리만 (bool), 참조 → 포인터 (std::optional<T&>는 없음), 값 → std::optional
+     */
+    template <typename R>
+    using ResultSlot = std::conditional_t<
+        std::is_void_v<R>, bool,
+        std::conditional_t<std::is_reference_v<R>,
+                           std::add_pointer_t<std::remove_reference_t<R>>,
+                           std::optional<R>>>;
+
+    /**
+     * 호출자 스택 위의 연산 + 결과 저장소
+     *
+     * combiner가 invoke(ds, context)로 실행, 예외는 잡아서 호출자에게 넘김
+     */
+    template <typename F, typename R>
+    struct Operation {
+        explicit Operation(F& f) : func(f) {}
+
+        F& func;
+        ResultSlot<R> result{};
+        std::exception_ptr error;
+
+        static void run(DS& ds, void* context) {
+            auto* self = static_cast<Operation*>(context);
+            try {
+                if constexpr (std::is_void_v<R>) {
+                    std::invoke(self->func, ds);
+                } else if constexpr (std::is_reference_v<R>) {
+                    // 이름 붙인 참조는 lvalue → T&와 T&& 모두 주소를 얻을 수 있음
+                    R&& value = std::invoke(self->func, ds);
+                    self->result = std::addressof(value);
+                } else {
+                    self->result.emplace(std::invoke(self->func, ds));
+                }
+            } catch (...) {
+                self->error = std::current_exception();
+            }
+        }
+    };
+
+    /**
+     * 빈 슬롯 차지
+     *
+     * 스레드별 고정 시작 위치 → 보통 매번 같은 슬롯 (내 캐시에 남아 있음)
+     */
+    Record& claim_record() {
+        const std::size_t start = thread_slot_index();
+        while (true) {
+            for (std::size_t i = 0; i < Slots; ++i) {
+                Record& record = records_[(start + i) & (Slots - 1)];
+                std::uint32_t expected = EMPTY;
+                if (record.state.load(std::memory_order_relaxed) == EMPTY &&
+                    record.state.compare_exchange_strong(
+                        expected, CLAIMED,
+                        std::memory_order_acquire,
+                        std::memory_order_relaxed)) {
+                    return record;
+                }
+            }
+            // 모든 슬롯이 사용 중 (스레드 > Slots) → 양보 후 재시도
+            std::this_thread::yield();
+        }
+    }
+
+    static std::size_t thread_slot_index() {
+        static std::atomic<std::size_t> next_index{0};
+        thread_local const std::size_t index =
+            next_index.fetch_add(1, std::memory_order_relaxed) & (Slots - 1);
+        return index;
+    }
+
+    /**
+     * combiner: 게시된 연산을 모두 실행 (combiner_lock_ 보유 중)
+     *
+     * 한 바퀴 도는 사이 새로 게시된 연산이 있으면 몇 바퀴 더
+     * → 락을 다시 잡지 않고 연달아 처리
+     */
+    void combine() {
+        std::uint64_t executed = 0;
+        for (int pass = 0; pass < max_combine_passes_; ++pass) {
+            std::uint64_t found = 0;
+            for (Record& record : records_) {
+                // acquire: 게시자의 invoke/context 쓰기가 보임
+                if (record.state.load(std::memory_order_acquire) != PENDING) {
+                    continue;
+                }
+                record.invoke(ds_, record.context);
+                // release: 연산 결과(호출자 스택, ds_)가 DONE과 함께 보임
+                record.state.store(DONE, std::memory_order_release);
+                ++found;
+            }
+            executed += found;
+            if (found == 0) {
+                break;
+            }
+        }
+
+        // combiner만 쓰므로 load + store로 충분 (RMW 불필요)
+        combined_operations_.store(
+            combined_operations_.load(std::memory_order_relaxed) + executed,
+            std::memory_order_relaxed);
+        combine_count_.store(
+            combine_count_.load(std::memory_order_relaxed) + 1,
+            std::memory_order_relaxed);
+    }
+
+private:
+    Record records_[Slots];
+
+    // combiner 선출용 락 (잡은 스레드만 ds_ 접근)
+    SpinLock combiner_lock_;
+
+    // combiner만 접근 → 같은 캐시라인에 모아 둠
+    alignas(64) DS ds_;
+    std::atomic<std::uint64_t> combined_operations_{0};
+    std::atomic<std::uint64_t> combine_count_{0};
+
+    // 대기 중 pause 횟수 (이후 yield)
+    static constexpr std::uint32_t spin_count_ = 64;
+
+    // combine 한 번에 최대 몇 바퀴 돌지
+    static constexpr int max_combine_passes_ = 3;
+};
+
+} // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
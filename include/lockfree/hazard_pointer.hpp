@@ -0,0 +1,344 @@
+/**
+ * Hazard Pointers - Safe Memory Reclamation (Maged Michael, 2004)
+ *
+ * 노드 기반 lock-free 구조의 근본 문제:
+ *   Thread A: old = head;            (old를 읽음)
+ *   Thread B: pop() → delete old;    (old 해제!)
+ *   Thread A: old->next              (use-after-free!)
+ *
+ * 태그(ABA 카운터)는 CAS 실패만 보장할 뿐, A가 CAS 전에
+ * old->next를 읽는 것 자체는 막지 못함 → 해제된 메모리 접근
+ *
+ * Hazard Pointer 핵심 아이디어:
+ *   "지금 이 노드를 보고 있으니 해제하지 마" 를 공유 슬롯에 게시
+ *   해제하려는 쪽은 바로 delete하지 않고 retire → 나중에 모든 슬롯을
+ *   훑어서(scan) 아무도 보고 있지 않은 노드만 해제
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  records_ ──► [rec] ──► [rec] ──► [rec] ──► nullptr         │
+ * │               hazard=A  hazard=0  hazard=C  ← 각자 캐시라인   │
+ * │                                                              │
+ * │  retired_ ──► A ──► B ──► C ──► D                            │
+ * │                                                              │
+ * │  scan(): 게시된 hazard = {A, C}                               │
+ * │          → B, D 해제 / A, C는 retired_에 다시 넣음             │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * 보호 프로토콜 (protect):
+ *   1. p = src.load()
+ *   2. hazard = p             ← 게시
+ *   3. seq_cst fence          ← 게시가 4번보다 먼저 보이도록
+ *   4. src.load() == p ?      ← 아직 구조 안에 있는지 확인
+ *      아니면 1번부터 (그 사이 제거되어 retire됐을 수 있음)
+ *
+ * 분할 상환 (amortized scan):
+ *   retire 때마다 scan하면 O(스레드 수) 비용이 매번 발생
+ *   → retired 수가 max(SCAN_THRESHOLD, 2 × record 수)를 넘을 때만 scan
+ *   → 노드당 scan 비용 O(1), 해제 대기 노드는 O(record 수)로 제한
+ *
+ * 사용 방법 (침습적 노드):
+ *   struct Node : HazardPointerNode { ... };
+ *   HazardPointerDomain domain(&reclaim_node, context);
+ *
+ *   HazardPointer hp(domain);
+ *   Node* n = hp.protect(head_);   // 이후 n은 해제되지 않음
+ *   ... CAS로 n을 구조에서 제거 ...
+ *   hp.reset_protection();
+ *   domain.retire(n);              // 안전해지면 reclaim_nodes(&n, 1, context)
+ *
+ * 해제는 묶음 단위: scan 한 번에 안전해진 노드를 최대 64개씩 모아
+ * reclaimer에 넘김 → MemoryPool::deallocate_bulk로 CAS 한 번에 반환 가능
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "reclamation.hpp"
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lockfree {
+
+/**
+ * retire될 노드의 기반 클래스
+ *
+ * retired 목록 링크를 노드 안에 둠 → retire가 메모리를 할당하지 않음
+ * (노드 자신의 next는 다른 스레드가 아직 읽을 수 있으므로 덮어쓰면 안 됨)
+ */
+struct HazardPointerNode {
+    HazardPointerNode* hp_retired_next = nullptr;
+};
+
+class HazardPointerDomain {
+public:
+    /**
+     * 안전해진 노드 묶음을 돌려주는 함수 (delete, pool.destroy_bulk 등)
+     */
+    using Reclaimer = detail::ReclaimBatch<HazardPointerNode>::Reclaimer;
+
+    // retired 수가 이 값(또는 2 × record 수)을 넘으면 scan
+    static constexpr std::size_t SCAN_THRESHOLD = 64;
+
+    explicit HazardPointerDomain(Reclaimer reclaim, void* context = nullptr)
+        : reclaim_(reclaim),
+          context_(context) {}
+
+    /**
+     * 소멸 시점에는 사용 중인 스레드가 없어야 함 → 남은 retired 전부 해제
+     * (record 목록은 이후 records_ 소멸자가 정리)
+     */
+    ~HazardPointerDomain() {
+        reclaim_all();
+    }
+
+    // Non-copyable, non-movable
+    HazardPointerDomain(const HazardPointerDomain&) = delete;
+    HazardPointerDomain& operator=(const HazardPointerDomain&) = delete;
+    HazardPointerDomain(HazardPointerDomain&&) = delete;
+    HazardPointerDomain& operator=(HazardPointerDomain&&) = delete;
+
+    /**
+     * 구조에서 제거된 노드를 해제 예약
+     *
+     * 호출 시점에 node는 이미 구조에서 unlink되어 있어야 함
+     * (새 스레드가 더 이상 node에 도달할 수 없음)
+     */
+    void retire(HazardPointerNode* node) {
+        push_retired(node, node);
+        std::size_t count = retired_count_.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (count >= scan_threshold()) {
+            scan();
+        }
+    }
+
+    /**
+     * 보호되지 않은 retired 노드를 지금 해제 (분할 상환 없이)
+     */
+    void scan() {
+        // retired 목록 전체를 가져옴 (push-only 목록의 pop-all → ABA 없음)
+        HazardPointerNode* list = retired_.exchange(nullptr, std::memory_order_acquire);
+        if (list == nullptr) {
+            return;
+        }
+
+        // unlink(호출자의 CAS) → 여기서 hazard 읽기 사이의 순서를 보장
+        // protect()의 seq_cst fence와 짝을 이룸
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::vector<const void*> hazards;
+        hazards.reserve(records_.size());
+        for (HazardRecord* rec = records_.head(); rec != nullptr; rec = rec->next) {
+            const void* p = rec->hazard.load(std::memory_order_acquire);
+            if (p != nullptr) {
+                hazards.push_back(p);
+            }
+        }
+        std::sort(hazards.begin(), hazards.end());
+
+        HazardPointerNode* keep_head = nullptr;
+        HazardPointerNode* keep_tail = nullptr;
+        std::size_t reclaimed = 0;
+        detail::ReclaimBatch<HazardPointerNode> batch(reclaim_, context_);
+
+        while (list != nullptr) {
+            HazardPointerNode* node = list;
+            list = list->hp_retired_next;
+
+            if (std::binary_search(hazards.begin(), hazards.end(), static_cast<const void*>(node))) {
+                // 아직 누군가 보는 중 → 다음 scan으로
+                node->hp_retired_next = keep_head;
+                keep_head = node;
+                if (keep_tail == nullptr) {
+                    keep_tail = node;
+                }
+            } else {
+                batch.add(node);
+                ++reclaimed;
+            }
+        }
+        batch.flush();
+
+        if (keep_head != nullptr) {
+            push_retired(keep_head, keep_tail);  // 남은 것들을 CAS 한 번으로 되돌림
+        }
+        retired_count_.fetch_sub(reclaimed, std::memory_order_relaxed);
+    }
+
+    /**
+     * 모든 retired 노드를 강제 해제
+     *
+     * 다른 스레드가 이 도메인을 쓰고 있지 않을 때만 (소멸자, 테스트)
+     */
+    void reclaim_all() {
+        HazardPointerNode* list = retired_.exchange(nullptr, std::memory_order_acquire);
+        detail::ReclaimBatch<HazardPointerNode> batch(reclaim_, context_);
+        while (list != nullptr) {
+            HazardPointerNode* next = list->hp_retired_next;
+            batch.add(list);
+            list = next;
+        }
+        batch.flush();
+        retired_count_.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * 해제 대기 중인 노드 수 (근사값)
+     */
+    std::size_t retired_count() const {
+        return retired_count_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * 지금까지 만들어진 hazard record 수 (= 동시에 쓰인 HazardPointer 최대 수)
+     */
+    std::size_t record_count() const {
+        return records_.size();
+    }
+
+private:
+    friend class HazardPointer;
+
+    /**
+     * Hazard record: 게시 슬롯 하나
+     *
+     * 한 번 만들어지면 도메인이 끝날 때까지 목록에 남음 (재사용)
+     * → scan이 목록을 락 없이 순회할 수 있음
+     */
+    struct alignas(64) HazardRecord {
+        std::atomic<const void*> hazard{nullptr};
+        std::atomic<bool> active{false};
+        HazardRecord* next = nullptr;  // push 후 불변
+    };
+
+    /**
+     * 빈 record 차지 (HazardPointer 생성 시)
+     */
+    HazardRecord* acquire_record() {
+        return records_.acquire();
+    }
+
+    static void release_record(HazardRecord* rec) {
+        rec->hazard.store(nullptr, std::memory_order_release);
+        detail::RecordRegistry<HazardRecord>::release(rec);
+    }
+
+    void push_retired(HazardPointerNode* first, HazardPointerNode* last) {
+        HazardPointerNode* head = retired_.load(std::memory_order_relaxed);
+        do {
+            last->hp_retired_next = head;
+        } while (!retired_.compare_exchange_weak(
+            head, first,
+            std::memory_order_release,
+            std::memory_order_relaxed));
+    }
+
+    std::size_t scan_threshold() const {
+        return std::max(SCAN_THRESHOLD, 2 * records_.size());
+    }
+
+private:
+    detail::RecordRegistry<HazardRecord> records_;
+
+    // retire 쪽 (record 목록과 다른 캐시라인)
+    alignas(64) std::atomic<HazardPointerNode*> retired_{nullptr};
+    std::atomic<std::size_t> retired_count_{0};
+
+    const Reclaimer reclaim_;
+    void* const context_;
+};
+
+// ============================================
+// HazardPointer: RAII 보호 슬롯 하나
+// ============================================
+// 생성 시 record 하나를 차지, 소멸 시 반납
+// 한 번에 한 포인터만 보호 (두 개가 필요하면 두 개 생성)
+class HazardPointer {
+public:
+    explicit HazardPointer(HazardPointerDomain& domain)
+        : record_(domain.acquire_record()) {}
+
+    ~HazardPointer() {
+        HazardPointerDomain::release_record(record_);
+    }
+
+    // Non-copyable, non-movable
+    HazardPointer(const HazardPointer&) = delete;
+    HazardPointer& operator=(const HazardPointer&) = delete;
+    HazardPointer(HazardPointer&&) = delete;
+    HazardPointer& operator=(HazardPointer&&) = delete;
+
+    /**
+     * src가 가리키는 노드를 보호하고 반환
+     *
+     * 반환 후 (reset 전까지) 그 노드는 해제되지 않음
+     * 단, 구조 안에 "계속 있다"는 보장은 아님 → CAS로 확인
+     */
+    template <typename T>
+    T* protect(const std::atomic<T*>& src) {
+        return protect(src, [](T* p) { return p; });
+    }
+
+    /**
+     * 태그가 섞인 값 등 atomic 값에서 포인터를 꺼내 보호
+     *
+     * @param src    load(memory_order)가 있는 atomic (std::atomic, AtomicTaggedPtr 등)
+     * @param to_ptr 값 → 보호할 포인터
+     * @return 검증된 atomic 값 (태그 포함 전체가 일치)
+     */
+    template <typename Atomic, typename F>
+    auto protect(const Atomic& src, F&& to_ptr) {
+        auto value = src.load(std::memory_order_relaxed);
+        while (true) {
+            record_->hazard.store(to_ptr(value), std::memory_order_relaxed);
+
+            // 게시(store)가 아래 재확인(load)보다 먼저 전역에 보이도록
+            // (store→load 재배치는 x86에서도 일어남 → 반드시 full fence)
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            auto current = src.load(std::memory_order_acquire);
+            if (current == value) {
+                return value;
+            }
+            value = current;  // 그 사이 바뀜 → 새 값으로 재시도
+        }
+    }
+
+    /**
+     * 이미 보호 중인 노드에서 읽은 포인터 등을 직접 게시
+     *
+     * 게시 후 그 포인터가 아직 유효한지는 호출자가 확인해야 함
+     */
+    void reset_protection(const void* ptr = nullptr) {
+        record_->hazard.store(ptr, std::memory_order_release);
+    }
+
+private:
+    HazardPointerDomain::HazardRecord* record_;
+};
+
+// ============================================
+// 자료구조용 Reclaimer 정책
+// ============================================
+// ABASafeStack<T, Reclaimer> 등이 사용하는 공통 인터페이스:
+//   node_base   : 노드가 상속할 기반 클래스
+//   domain_type : 자료구조가 하나씩 보유 (묶음 Reclaimer 함수 + context로 생성)
+//   guard_type  : 연산 하나 동안의 보호 (domain으로 생성, protect(src, to_ptr))
+struct HazardPointerReclaimer {
+    using node_base = HazardPointerNode;
+    using domain_type = HazardPointerDomain;
+    using guard_type = HazardPointer;
+};
+
+} // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
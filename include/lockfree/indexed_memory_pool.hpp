@@ -0,0 +1,387 @@
+/**
+ * Index-Addressed Lock-Free Memory Pool
+ *
+ * MemoryPool과 같은 free list 풀이지만 블록을 포인터 대신 32비트 인덱스로 가리킴
+ *
+ * 왜 인덱스인가?
+ *   - (인덱스 32비트 + 태그 32비트) = 64비트 CAS 하나 → 128비트 CAS 불필요
+ *   - 태그 32비트 → 42억 연산마다 한 바퀴 (packed 포인터의 16비트보다 65536배)
+ *   - 주소 폭과 무관 (5-level paging/LA57에서도 그대로)
+ *   - free list 링크가 4바이트 → 블록 최소 크기 절반, 캐시에 더 많이 들어감
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  free_list_ (64비트):  [ tag (32) | index (32) ]             │
+ * │                                                              │
+ * │  chunks_ (청크 테이블, 크기가 2배씩 커짐 → 최대 33개)            │
+ * │  ┌─────────┬─────────┬───────────────┬───────────────────┐  │
+ * │  │ chunk 0 │ chunk 1 │ chunk 2       │ chunk 3           │  │
+ * │  │ [0, B)  │ [B, 2B) │ [2B, 4B)      │ [4B, 8B)          │  │
+ * │  └─────────┴─────────┴───────────────┴───────────────────┘  │
+ * │                                                              │
+ * │  index → 청크: k = bit_width(index >> log2(B))                │
+ * │          오프셋: index - (k == 0 ? 0 : B << (k - 1))           │
+ * │  → 나눗셈/검색 없이 비트 연산 몇 개로 주소 계산                    │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * 블록 메모리는 풀이 끝날 때까지 해제되지 않음 (type-stable)
+ *   → 낡은 인덱스로 링크를 읽어도 유효한 메모리, 잘못된 값은 태그 CAS가 거름
+ *
+ * 사용 예:
+ *   IndexedMemoryPool<Particle> pool(1024);
+ *   auto idx = pool.construct(x, y);
+ *   pool.get(idx)->update();
+ *   pool.destroy(idx);
+ */
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lockfree {
+
+/**
+ * Index-Addressed Lock-Free Memory Pool
+ *
+ * @tparam T 저장할 타입
+ */
+template <typename T>
+class IndexedMemoryPool {
+public:
+    using Index = std::uint32_t;
+
+    // "없음" 인덱스 (블록 인덱스로는 쓰이지 않음)
+    static constexpr Index NULL_INDEX = ~Index{0};
+
+private:
+    // ========================================
+    // 블록 레이아웃
+    // ========================================
+
+    /**
+     * 미사용 블록의 첫 4바이트 = 다음 free 블록 인덱스 (intrusive)
+     *
+     * 다른 스레드가 낡은 인덱스로 동시에 읽을 수 있음 → atomic_ref로 접근
+     */
+    static constexpr std::size_t BLOCK_ALIGNMENT =
+        (alignof(T) > alignof(Index)) ? alignof(T) : alignof(Index);
+
+    static constexpr std::size_t RAW_BLOCK_SIZE =
+        (sizeof(T) > sizeof(Index)) ? sizeof(T) : sizeof(Index);
+
+    static constexpr std::size_t BLOCK_SIZE =
+        (RAW_BLOCK_SIZE + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+
+    // 청크 k는 base << (k - 1)개 블록 (k ≥ 1) → 32비트 인덱스 공간에 최대 33개
+    static constexpr std::size_t MAX_CHUNKS = 33;
+
+    /**
+     * 메모리 청크 (MemoryPool::Chunk와 같은 정렬 방식)
+     */
+    struct Chunk {
+        std::unique_ptr<std::byte[]> memory;
+        std::size_t block_count = 0;
+
+        void allocate(std::size_t count) {
+            block_count = count;
+            memory = std::make_unique<std::byte[]>(count * BLOCK_SIZE + BLOCK_ALIGNMENT);
+        }
+
+        std::byte* aligned_start() const {
+            std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(memory.get());
+            std::uintptr_t aligned = (addr + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+            return reinterpret_cast<std::byte*>(aligned);
+        }
+    };
+
+    // ========================================
+    // Tagged Index (ABA 방지)
+    // ========================================
+    // [63 ─ 32] tag, [31 ─ 0] index → 64비트 CAS 하나
+    static constexpr std::uint64_t pack(Index index, std::uint32_t tag) {
+        return (static_cast<std::uint64_t>(tag) << 32) | index;
+    }
+
+    static constexpr Index index_of(std::uint64_t word) {
+        return static_cast<Index>(word);
+    }
+
+    static constexpr std::uint32_t tag_of(std::uint64_t word) {
+        return static_cast<std::uint32_t>(word >> 32);
+    }
+
+public:
+    // ========================================
+    // 생성자 / 소멸자
+    // ========================================
+
+    /**
+     * 생성자
+     *
+     * @param initial_capacity 첫 청크 블록 수 (2의 거듭제곱으로 올림)
+     * @param growable         풀 확장 허용 여부 (확장 시 청크 크기 2배씩)
+     */
+    explicit IndexedMemoryPool(std::size_t initial_capacity = 1024, bool growable = true)
+        : base_shift_(static_cast<unsigned>(std::bit_width(std::bit_ceil(
+              initial_capacity > 0 ? initial_capacity : std::size_t{1})) - 1)),
+          growable_(growable)
+    {
+        assert(base_shift_ < 32 && "initial capacity must fit in 32-bit indices");
+        add_chunk(0);
+    }
+
+    ~IndexedMemoryPool() {
+        // 디버그: 할당된 블록이 모두 반환되었는지 확인
+        assert(allocated_count_.load() == 0 && "Memory leak: some blocks not deallocated");
+    }
+
+    // 복사/이동 금지
+    IndexedMemoryPool(const IndexedMemoryPool&) = delete;
+    IndexedMemoryPool& operator=(const IndexedMemoryPool&) = delete;
+    IndexedMemoryPool(IndexedMemoryPool&&) = delete;
+    IndexedMemoryPool& operator=(IndexedMemoryPool&&) = delete;
+
+    // ========================================
+    // 핵심 API
+    // ========================================
+
+    /**
+     * 블록 하나 할당
+     *
+     * @return 블록 인덱스, 실패 시 NULL_INDEX
+     */
+    Index allocate() {
+        while (true) {
+            std::size_t chunks_seen = chunk_count_.load(std::memory_order_acquire);
+            Index index = pop_free();
+            if (index != NULL_INDEX) {
+                allocated_count_.fetch_add(1, std::memory_order_relaxed);
+                return index;
+            }
+            // 비었음 → 확장 (다른 스레드가 이미 했으면 그 블록을 다시 시도)
+            if (!growable_ || !add_chunk(chunks_seen)) {
+                return NULL_INDEX;
+            }
+        }
+    }
+
+    /**
+     * 블록 반환
+     */
+    void deallocate(Index index) {
+        if (index == NULL_INDEX) return;
+        push_free(index, index);
+        allocated_count_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * 할당 + 생성자 호출
+     *
+     * @return 생성된 객체의 인덱스, 실패 시 NULL_INDEX
+     */
+    template <typename... Args>
+    Index construct(Args&&... args) {
+        Index index = allocate();
+        if (index != NULL_INDEX) {
+            new (get(index)) T(std::forward<Args>(args)...);  // placement new
+        }
+        return index;
+    }
+
+    /**
+     * 소멸자 호출 + 반환
+     */
+    void destroy(Index index) {
+        if (index != NULL_INDEX) {
+            get(index)->~T();
+            deallocate(index);
+        }
+    }
+
+    /**
+     * 인덱스 → 주소 (락 없음, 비트 연산 + 테이블 조회 한 번)
+     */
+    T* get(Index index) const {
+        return reinterpret_cast<T*>(block_address(index));
+    }
+
+    // ========================================
+    // 유틸리티
+    // ========================================
+
+    std::size_t capacity() const {
+        return total_blocks_.load(std::memory_order_relaxed);
+    }
+
+    std::size_t allocated_count() const {
+        return allocated_count_.load(std::memory_order_relaxed);
+    }
+
+    std::size_t available_count() const {
+        return capacity() - allocated_count();
+    }
+
+    std::size_t chunk_count() const {
+        return chunk_count_.load(std::memory_order_acquire);
+    }
+
+    bool is_growable() const {
+        return growable_;
+    }
+
+    static constexpr std::size_t block_size() {
+        return BLOCK_SIZE;
+    }
+
+    /**
+     * Lock-Free 여부 (64비트 CAS만 사용)
+     */
+    static bool is_lock_free() {
+        return std::atomic<std::uint64_t>::is_always_lock_free;
+    }
+
+private:
+    // ========================================
+    // 내부 구현
+    // ========================================
+
+    // 청크 k의 첫 블록 인덱스
+    Index chunk_first_index(std::size_t k) const {
+        return k == 0 ? 0 : static_cast<Index>(std::size_t{1} << (base_shift_ + k - 1));
+    }
+
+    std::size_t chunk_block_count(std::size_t k) const {
+        return k == 0 ? (std::size_t{1} << base_shift_) : (std::size_t{1} << (base_shift_ + k - 1));
+    }
+
+    std::byte* block_address(Index index) const {
+        std::size_t k = static_cast<std::size_t>(std::bit_width(index >> base_shift_));
+        std::byte* start = chunk_starts_[k].load(std::memory_order_acquire);
+        return start + static_cast<std::size_t>(index - chunk_first_index(k)) * BLOCK_SIZE;
+    }
+
+    // 블록 첫 4바이트의 free 링크
+    std::atomic_ref<Index> link(Index index) const {
+        return std::atomic_ref<Index>(*reinterpret_cast<Index*>(block_address(index)));
+    }
+
+    /**
+     * 청크 추가
+     *
+     * @param expected_count 호출자가 본 청크 수 (그 사이 다른 스레드가 늘렸으면 아무것도 안 함)
+     * @return 새 블록이 생겼으면(누가 추가했든) true, 인덱스 공간이 다 찼으면 false
+     */
+    bool add_chunk(std::size_t expected_count) {
+        while (chunks_lock_.test_and_set(std::memory_order_acquire)) {
+            // spin-wait (청크 추가는 드묾)
+        }
+
+        std::size_t k = chunk_count_.load(std::memory_order_relaxed);
+        if (k != expected_count) {
+            chunks_lock_.clear(std::memory_order_release);
+            return true;
+        }
+
+        std::size_t count = chunk_block_count(k);
+        std::size_t first = chunk_first_index(k);
+        if (k >= MAX_CHUNKS || first + count > NULL_INDEX) {
+            chunks_lock_.clear(std::memory_order_release);
+            return false;  // 32비트 인덱스 공간 소진
+        }
+
+        chunks_[k].allocate(count);
+        chunk_starts_[k].store(chunks_[k].aligned_start(), std::memory_order_release);
+        chunk_count_.store(k + 1, std::memory_order_release);
+        chunks_lock_.clear(std::memory_order_release);
+
+        // 청크 안의 블록을 미리 연결 → free list에 CAS 한 번으로 붙임
+        Index first_index = static_cast<Index>(first);
+        Index last_index = static_cast<Index>(first + count - 1);
+        for (Index i = first_index; i < last_index; ++i) {
+            link(i).store(i + 1, std::memory_order_relaxed);
+        }
+        push_free(first_index, last_index);
+
+        total_blocks_.fetch_add(count, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * Free List에서 pop (Lock-Free, 32비트 태그로 ABA 방지)
+     */
+    Index pop_free() {
+        std::uint64_t old_head = free_list_.load(std::memory_order_acquire);
+
+        while (index_of(old_head) != NULL_INDEX) {
+            // 낡은 head면 next가 틀릴 수 있음 → 태그가 달라 CAS 실패
+            Index next = link(index_of(old_head)).load(std::memory_order_relaxed);
+            std::uint64_t new_head = pack(next, tag_of(old_head) + 1);
+
+            if (free_list_.compare_exchange_weak(
+                old_head, new_head,
+                std::memory_order_acquire,
+                std::memory_order_acquire
+            )) {
+                return index_of(old_head);
+            }
+        }
+        return NULL_INDEX;
+    }
+
+    /**
+     * 미리 연결된 체인 [first ... last]를 Free List에 push
+     */
+    void push_free(Index first, Index last) {
+        std::uint64_t old_head = free_list_.load(std::memory_order_relaxed);
+        std::uint64_t new_head;
+
+        do {
+            link(last).store(index_of(old_head), std::memory_order_relaxed);
+            new_head = pack(first, tag_of(old_head) + 1);
+        } while (!free_list_.compare_exchange_weak(
+            old_head, new_head,
+            std::memory_order_release,
+            std::memory_order_relaxed
+        ));
+    }
+
+private:
+    // ========================================
+    // 멤버 변수
+    // ========================================
+
+    // Free List Head: [tag 32 | index 32]
+    alignas(64) std::atomic<std::uint64_t> free_list_{pack(NULL_INDEX, 0)};
+
+    // 청크 테이블 (읽기는 락 없이, 추가는 chunks_lock_ 아래에서)
+    std::atomic<std::byte*> chunk_starts_[MAX_CHUNKS] = {};
+    Chunk chunks_[MAX_CHUNKS];
+    std::atomic<std::size_t> chunk_count_{0};
+    std::atomic_flag chunks_lock_ = ATOMIC_FLAG_INIT;
+
+    // 통계
+    std::atomic<std::size_t> total_blocks_{0};
+    std::atomic<std::size_t> allocated_count_{0};
+
+    // 설정
+    const unsigned base_shift_;  // log2(첫 청크 블록 수)
+    const bool growable_;
+};
+
+} // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
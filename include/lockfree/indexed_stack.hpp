@@ -0,0 +1,193 @@
+/**
+ * Index-Addressed Lock-Free Stack (Treiber Stack with Tagged Index)
+ *
+ * ABASafeStack과 같은 알고리즘이지만 노드를 IndexedMemoryPool 인덱스로 가리킴
+ *
+ * ┌─────────────────────────────────────────────────────────┐
+ * │  head_ (64-bit atomic)                                   │
+ * ├────────────────────────────┬────────────────────────────┤
+ * │  Tag (32 bits)             │  Node index (32 bits)      │
+ * └────────────────────────────┴────────────────────────────┘
+ *
+ * ABASafeStack과의 차이:
+ *   - 태그 32비트 + 인덱스 32비트 → 64비트 CAS로 충분 (128비트 CAS 불필요)
+ *   - 노드 링크 4바이트 (포인터 8바이트의 절반)
+ *   - 노드 메모리는 풀 안에서만 재사용되고 스택이 끝날 때까지 해제되지 않음
+ *     → pop이 낡은 노드의 next를 읽어도 유효한 메모리 (값이 틀리면 태그 CAS 실패)
+ *     → hazard pointer/epoch 없이 use-after-free가 없음
+ *
+ * 제약:
+ *   - 동시에 들어 있을 수 있는 원소 수 < 2^32 - 1
+ *   - 스택이 줄어도 풀 메모리는 돌려주지 않음 (최대 사용량 유지)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <utility>
+
+#include "indexed_memory_pool.hpp"
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lockfree {
+
+/**
+ * Index-Addressed Lock-Free Stack
+ *
+ * @tparam T 저장할 타입
+ */
+template <typename T>
+class IndexedStack {
+    using Index = std::uint32_t;
+
+    /**
+     * 노드: next 인덱스 + 값 저장 공간
+     *
+     * 값은 push에서 생성, pop에서 소멸 (노드 자체는 풀이 재사용)
+     * next는 낡은 pop이 동시에 읽을 수 있음 → atomic_ref로 접근
+     */
+    struct Node {
+        Index next;
+        alignas(T) std::byte storage[sizeof(T)];
+
+        T* value() {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+
+        std::atomic_ref<Index> link() {
+            return std::atomic_ref<Index>(next);
+        }
+    };
+
+    using Pool = IndexedMemoryPool<Node>;
+    static constexpr Index NULL_INDEX = Pool::NULL_INDEX;
+
+    // [63 ─ 32] tag, [31 ─ 0] index
+    static constexpr std::uint64_t pack(Index index, std::uint32_t tag) {
+        return (static_cast<std::uint64_t>(tag) << 32) | index;
+    }
+
+    static constexpr Index index_of(std::uint64_t word) {
+        return static_cast<Index>(word);
+    }
+
+    static constexpr std::uint32_t tag_of(std::uint64_t word) {
+        return static_cast<std::uint32_t>(word >> 32);
+    }
+
+public:
+    /**
+     * @param initial_capacity 노드 풀의 첫 청크 크기 (필요하면 2배씩 확장)
+     */
+    explicit IndexedStack(std::size_t initial_capacity = 1024)
+        : pool_(initial_capacity) {}
+
+    ~IndexedStack() {
+        while (pop()) {}
+    }
+
+    // 복사/이동 금지
+    IndexedStack(const IndexedStack&) = delete;
+    IndexedStack& operator=(const IndexedStack&) = delete;
+    IndexedStack(IndexedStack&&) = delete;
+    IndexedStack& operator=(IndexedStack&&) = delete;
+
+    /**
+     * @return 성공 여부 (인덱스 공간이 다 차면 false)
+     */
+    bool push(const T& value) {
+        return emplace(value);
+    }
+
+    bool push(T&& value) {
+        return emplace(std::move(value));
+    }
+
+    /**
+     * @return 제거된 값 (스택이 비었으면 nullopt)
+     */
+    std::optional<T> pop() {
+        std::uint64_t old_head = head_.load(std::memory_order_acquire);
+
+        while (index_of(old_head) != NULL_INDEX) {
+            Node* node = pool_.get(index_of(old_head));
+            // 노드가 이미 다른 스레드에 의해 pop/재사용됐을 수 있음 → 태그가 CAS를 막음
+            Index next = node->link().load(std::memory_order_relaxed);
+
+            if (head_.compare_exchange_weak(
+                    old_head, pack(next, tag_of(old_head) + 1),
+                    std::memory_order_acquire,
+                    std::memory_order_acquire)) {
+                // CAS 성공 = 이 스레드만 값에 접근
+                T* slot = node->value();
+                std::optional<T> result(std::move(*slot));
+                slot->~T();
+                pool_.deallocate(index_of(old_head));
+                return result;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * 스택이 비어있는지 확인 (근사값)
+     */
+    bool empty() const {
+        return index_of(head_.load(std::memory_order_acquire)) == NULL_INDEX;
+    }
+
+    /**
+     * 노드 풀 용량 (지금까지 확장된 크기)
+     */
+    std::size_t capacity() const {
+        return pool_.capacity();
+    }
+
+    /**
+     * Lock-Free 여부 (64비트 CAS만 사용)
+     */
+    static bool is_lock_free() {
+        return std::atomic<std::uint64_t>::is_always_lock_free && Pool::is_lock_free();
+    }
+
+private:
+    template <typename U>
+    bool emplace(U&& value) {
+        Index index = pool_.allocate();
+        if (index == NULL_INDEX) {
+            return false;
+        }
+        Node* node = pool_.get(index);
+        new (node->storage) T(std::forward<U>(value));
+
+        std::uint64_t old_head = head_.load(std::memory_order_relaxed);
+        do {
+            node->link().store(index_of(old_head), std::memory_order_relaxed);
+        } while (!head_.compare_exchange_weak(
+            old_head, pack(index, tag_of(old_head) + 1),
+            std::memory_order_release,
+            std::memory_order_relaxed));
+        return true;
+    }
+
+private:
+    // 풀이 먼저 생성/나중에 소멸 (소멸자의 pop이 풀을 씀)
+    Pool pool_;
+
+    alignas(64) std::atomic<std::uint64_t> head_{pack(NULL_INDEX, 0)};
+};
+
+} // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,136 @@
+/**
+ * Inline Function - 힙 할당 없는 고정 용량 callable
+ *
+ * std::function의 문제:
+ *   - SBO(small buffer) 크기가 구현마다 다름 (libstdc++ 16바이트)
+ *   - 캡처가 그보다 크면 생성할 때마다 new → MemoryPool<Job>을 써도 할당이 남음
+ *   - 복사 가능해야 함 → move-only 캡처(unique_ptr 등)를 못 받음
+ *
+ * InlineFunction:
+ *   - 캡처를 객체 안의 고정 버퍼에 직접 생성 (할당 0회)
+ *   - 버퍼보다 큰 callable은 컴파일 에러 (조용히 힙으로 가지 않음)
+ *   - 복사/이동 불가 → 만들어진 자리(Job 블록)에서만 실행
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  InlineFunction<void(), 48>  (64바이트 = 캐시라인 하나)        │
+ * ├───────────────────────────────────────────────┬─────────────┤
+ * │  storage_ [48바이트] ← 람다 캡처가 여기에 생성  │  ops_ (8)   │
+ * └───────────────────────────────────────────────┴─────────────┘
+ *   ops_ → 타입별 정적 테이블 { invoke, destroy } (가상 함수 테이블과 같은 역할)
+ *
+ * 캡처가 너무 크면:
+ *   - 큰 데이터는 참조/포인터로 캡처
+ *   - 여러 값을 묶은 구조체를 밖에 두고 포인터 하나만 캡처
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace lockfree {
+
+template <typename Signature, std::size_t Capacity = 48>
+class InlineFunction;
+
+/**
+ * @tparam R, Args  호출 시그니처
+ * @tparam Capacity 캡처 저장 용량 (바이트)
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+class InlineFunction<R(Args...), Capacity> {
+public:
+    static constexpr std::size_t CAPACITY = Capacity;
+
+    /**
+     * F를 이 버퍼에 담을 수 있는지 (컴파일 타임)
+     */
+    template <typename F>
+    static constexpr bool fits =
+        sizeof(F) <= Capacity && alignof(F) <= alignof(std::max_align_t);
+
+    InlineFunction() noexcept = default;
+
+    template <typename F>
+        requires(!std::is_same_v<std::remove_cvref_t<F>, InlineFunction> &&
+                 std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+    InlineFunction(F&& func) {  // NOLINT: std::function처럼 암시적 변환 허용
+        emplace(std::forward<F>(func));
+    }
+
+    ~InlineFunction() {
+        reset();
+    }
+
+    // 복사/이동 금지 (캡처는 만들어진 자리에서만 산다)
+    InlineFunction(const InlineFunction&) = delete;
+    InlineFunction& operator=(const InlineFunction&) = delete;
+    InlineFunction(InlineFunction&&) = delete;
+    InlineFunction& operator=(InlineFunction&&) = delete;
+
+    /**
+     * 기존 callable을 지우고 새 callable을 버퍼에 생성
+     */
+    template <typename F>
+    void emplace(F&& func) {
+        using Fn = std::decay_t<F>;
+        static_assert(sizeof(Fn) <= Capacity,
+                      "callable is larger than the InlineFunction buffer: "
+                      "capture large data by reference or pointer");
+        static_assert(alignof(Fn) <= alignof(std::max_align_t),
+                      "callable is over-aligned for the InlineFunction buffer");
+
+        reset();
+        ::new (static_cast<void*>(storage_)) Fn(std::forward<F>(func));
+        ops_ = &OPS<Fn>;
+    }
+
+    /**
+     * 담긴 callable 소멸 (비어 있으면 아무것도 안 함)
+     */
+    void reset() noexcept {
+        if (ops_ != nullptr) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+    explicit operator bool() const noexcept {
+        return ops_ != nullptr;
+    }
+
+    /**
+     * 호출 (비어 있으면 정의되지 않은 동작 - operator bool로 먼저 확인)
+     */
+    R operator()(Args... args) {
+        return ops_->invoke(storage_, std::forward<Args>(args)...);
+    }
+
+private:
+    // 타입별 정적 테이블 (객체마다 함수 포인터 두 개를 들고 다니지 않음)
+    struct Ops {
+        R (*invoke)(void*, Args&&...);
+        void (*destroy)(void*) noexcept;
+    };
+
+    template <typename Fn>
+    static R invoke_impl(void* storage, Args&&... args) {
+        return std::invoke(*std::launder(static_cast<Fn*>(storage)), std::forward<Args>(args)...);
+    }
+
+    template <typename Fn>
+    static void destroy_impl(void* storage) noexcept {
+        std::launder(static_cast<Fn*>(storage))->~Fn();
+    }
+
+    template <typename Fn>
+    static constexpr Ops OPS{&invoke_impl<Fn>, &destroy_impl<Fn>};
+
+    alignas(std::max_align_t) std::byte storage_[Capacity];
+    const Ops* ops_ = nullptr;
+};
+
+} // namespace lockfree
@@ -7,7 +7,7 @@
  *   - Lock-Free Job 큐 (MPMC Queue 활용)
  *   - Memory Pool 기반 Job 할당
  *   - Job 의존성 지원 (Counter)
- *   - Work Stealing (고급, 선택)
+ *   - Work Stealing 모드 (생성 시 선택, SchedulerMode::WorkStealing)
  * 
  * 사용 예:
  *   JobSystem js(4);  // 4개 워커 스레드
@@ -31,6 +31,20 @@
  * │  │ Worker 0│  │ Worker 1│  │ Worker 2│  │ Worker 3│         │
  * │  └─────────┘  └─────────┘  └─────────┘  └─────────┘         │
  * └─────────────────────────────────────────────────────────────┘
+ *
+ * Work Stealing 모드 (JobSystem js(4, SchedulerMode::WorkStealing)):
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  외부 스레드 schedule ──► Global Queue (MPMC)                 │
+ * │                                                              │
+ * │  Worker 0         Worker 1         Worker 2         Worker 3 │
+ * │  [deque]          [deque]          [deque]          [deque]  │
+ * │    ▲ │              ▲                                        │
+ * │    │ └ pop (LIFO)   └──── steal (FIFO, 무작위 victim)         │
+ * │    └ 워커 안에서 schedule (자식 Job)                          │
+ * │                                                              │
+ * │  워커가 Job 찾는 순서: 자기 deque → Global Queue → 훔치기     │
+ * └─────────────────────────────────────────────────────────────┘
+ *   → 워커끼리 같은 head/tail을 두드리지 않음 (공유 큐는 외부 제출만)
  */
 
 #pragma once
@@ -38,13 +52,22 @@
 #include <atomic>
 #include <thread>
 #include <vector>
-#include <functional>
 #include <cstdint>
 #include <cassert>
+#include <memory>
 
 // 우리가 만든 Lock-Free 자료구조들!
 #include "mpmc_queue.hpp"
 #include "memory_pool.hpp"
+#include "work_stealing_deque.hpp"
+#include "inline_function.hpp"
+#include "ms_queue.hpp"
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
 
 namespace lockfree {
 
@@ -55,35 +78,77 @@ namespace lockfree {
 struct Job;
 struct Counter;
 
+// ========================================
+// 스케줄러 모드
+// ========================================
+
+/**
+ * Job 분배 방식 (생성 시 선택)
+ *
+ * SharedQueue:  모든 Job이 하나의 MPMC 큐를 거침 (단순, 워커가 적을 때 충분)
+ * WorkStealing: 워커별 Chase-Lev deque + 외부 제출용 공유 큐
+ *               (워커 안에서 Job을 쪼개는 재귀/fork-join 작업에 유리)
+ */
+enum class SchedulerMode {
+    SharedQueue,
+    WorkStealing
+};
+
+/**
+ * 공유 큐(4096칸)가 가득 찼을 때 schedule의 동작
+ *
+ * HelpUntilSpace: 호출자가 대기 중인 Job을 실행하며 자리가 날 때까지 재시도 (기본)
+ * RunInline:      새 Job을 호출자 스레드에서 바로 실행
+ * Spill:          크기 제한 없는 보조 큐(MSQueue)로 넘김 (공유 큐가 빈 뒤에 실행)
+ * Reject:         schedule이 false 반환, Job은 예약되지 않음
+ *
+ * 어느 정책이든 넘침 횟수는 overflow_count()로 집계
+ */
+enum class OverflowPolicy {
+    HelpUntilSpace,
+    RunInline,
+    Spill,
+    Reject
+};
+
 // ========================================
 // Job 구조체
 // ========================================
 
+/**
+ * Job 안에 직접 담는 callable 용량 (바이트)
+ *
+ * 참조 캡처 6개, 또는 포인터 몇 개 + 인덱스 범위 정도
+ * 더 큰 캡처는 컴파일 에러 → 큰 데이터는 참조/포인터로 캡처
+ */
+inline constexpr std::size_t JOB_FUNCTION_CAPACITY = 48;
+
 /**
  * Job: 실행할 작업 단위
  * 
  * ┌─────────────────────────────────────────────────────────────┐
- * │  Job 구조                                                    │
+ * │  Job 구조 (128바이트 = 캐시라인 2개, 풀 블록 하나)             │
  * │                                                              │
- * │  ┌──────────────┐                                           │
- * │  │   function   │  ← 실행할 함수                            │
- * │  │   counter    │  ← 완료 시 감소할 카운터                   │
- * │  │   parent     │  ← 부모 Job (선택)                        │
- * │  │ unfinished   │  ← 자식 Job 수 + 1                        │
- * │  └──────────────┘                                           │
+ * │  line 0 ┌──────────────┐                                    │
+ * │         │   function   │  ← 캡처 48바이트 + ops 포인터       │
+ * │  line 1 ├──────────────┤                                    │
+ * │         │   counter    │  ← 완료 시 감소할 카운터             │
+ * │         │   parent     │  ← 부모 Job (선택)                  │
+ * │         │ unfinished   │  ← 자식 Job 수 + 1                  │
+ * │         └──────────────┘                                    │
  * └─────────────────────────────────────────────────────────────┘
  * 
- * TODO: 직접 구현해보세요!
+ * alignas(64): 인접한 풀 블록의 Job끼리 캐시라인을 나누지 않음
+ *             (서로 다른 워커가 이웃 Job의 unfinished_jobs를 건드려도 false sharing 없음)
  */
-struct Job {
+struct alignas(64) Job {
     /**
      * 실행할 함수
      * 
-     * 힌트: std::function<void()> 사용
-     * 주의: std::function은 약간의 오버헤드가 있음
-     *       (고성능 버전에서는 함수 포인터 + void* 사용)
+     * std::function 대신 InlineFunction: 캡처를 Job 안에 직접 생성
+     * → schedule()이 풀 블록 하나 외에는 할당하지 않음
      */
-    std::function<void()> function;
+    InlineFunction<void(), JOB_FUNCTION_CAPACITY> function;
     
     /**
      * 완료 시 감소할 카운터 (선택적)
@@ -122,6 +187,8 @@ struct Job {
     {}
 };
 
+static_assert(sizeof(Job) == 128, "Job should occupy exactly two cache lines");
+
 // ========================================
 // Counter 구조체
 // ========================================
@@ -247,6 +314,32 @@ private:
      * 모든 워커가 여기서 Job을 가져감
      */
     MPMCQueue<Job*, DEFAULT_QUEUE_SIZE> job_queue_;
+
+    /**
+     * 워커별 로컬 deque (WorkStealing 모드에서만 사용)
+     *
+     * 주인 워커만 push/pop, 다른 워커/외부 스레드는 steal
+     * deque마다 캐시라인 분리 (top/bottom은 deque 안에서 이미 분리됨)
+     */
+    struct alignas(64) LocalQueue {
+        WorkStealingDeque<Job*> deque{256};
+    };
+    std::vector<std::unique_ptr<LocalQueue>> local_queues_;
+
+    /**
+     * Job 분배 방식
+     */
+    const SchedulerMode mode_;
+
+    /**
+     * 공유 큐가 가득 찼을 때의 동작
+     */
+    const OverflowPolicy overflow_policy_;
+
+    /**
+     * 넘친 Job 보관 (OverflowPolicy::Spill에서만 사용)
+     */
+    MSQueue<Job*> overflow_queue_;
     
     /**
      * Job 메모리 풀
@@ -274,6 +367,11 @@ private:
      */
     std::atomic<std::size_t> pending_jobs_{0};
 
+    /**
+     * 공유 큐가 가득 차서 넘침 정책이 동작한 횟수 (통계)
+     */
+    std::atomic<std::size_t> overflow_count_{0};
+
 public:
     // ========================================
     // TODO: 생성자
@@ -285,6 +383,8 @@ public:
      * @param num_workers 워커 스레드 수 (0이면 하드웨어 스레드 수)
      * @param queue_size Job 큐 크기
      * @param pool_size Job 풀 크기
+     * @param mode Job 분배 방식 (기본: 공유 큐)
+     * @param overflow 공유 큐가 가득 찼을 때의 동작 (기본: 다른 Job 실행하며 대기)
      * 
      * 알고리즘:
      * 1. num_workers가 0이면 std::thread::hardware_concurrency() 사용
@@ -294,8 +394,20 @@ public:
     explicit JobSystem(
         std::size_t num_workers = 0,
         std::size_t queue_size = DEFAULT_QUEUE_SIZE,
-        std::size_t pool_size = DEFAULT_POOL_SIZE
+        std::size_t pool_size = DEFAULT_POOL_SIZE,
+        SchedulerMode mode = SchedulerMode::SharedQueue,
+        OverflowPolicy overflow = OverflowPolicy::HelpUntilSpace
     );
+
+    /**
+     * 모드/넘침 정책만 지정하는 생성자
+     *
+     * JobSystem js(4, SchedulerMode::WorkStealing);
+     * JobSystem js(4, SchedulerMode::SharedQueue, OverflowPolicy::Spill);
+     */
+    JobSystem(std::size_t num_workers, SchedulerMode mode,
+              OverflowPolicy overflow = OverflowPolicy::HelpUntilSpace)
+        : JobSystem(num_workers, DEFAULT_QUEUE_SIZE, DEFAULT_POOL_SIZE, mode, overflow) {}
     
     // ========================================
     // TODO: 소멸자
@@ -334,9 +446,12 @@ public:
      * 4. Job 큐에 push
      * 
      * 힌트: job_pool_.construct() 사용
+     *
+     * @return 예약 성공 여부 (OverflowPolicy::Reject에서 큐가 가득 차면 false,
+     *         이때 Job은 반환되고 counter는 원래대로)
      */
     template <typename F>
-    void schedule(F&& func, Counter* counter = nullptr);
+    bool schedule(F&& func, Counter* counter = nullptr);
     
     /**
      * Job 스케줄링 (Job 포인터 버전)
@@ -344,8 +459,28 @@ public:
      * @param job 스케줄할 Job (이미 할당/초기화됨)
      * 
      * 주의: Job은 job_pool_에서 할당받은 것이어야 함
+     *
+     * WorkStealing 모드: 이 JobSystem의 워커 스레드에서 호출하면 그 워커의
+     * 로컬 deque로, 그 외 스레드에서 호출하면 공유 큐로 들어감
+     *
+     * @return false = 거부됨 (OverflowPolicy::Reject), Job 소유권은 호출자에게 남음
+     */
+    bool schedule(Job* job);
+
+    /**
+     * 자식 Job 스케줄링 (fork-join)
+     *
+     * @param parent 아직 완료되지 않은 부모 Job (보통 부모의 함수 안에서 호출)
+     * @param func   실행할 함수
+     *
+     * parent->unfinished_jobs를 먼저 올린 뒤 예약 → 부모는 자기 함수와
+     * 모든 자식이 끝나야 완료되고, 그때 부모의 counter가 감소함
+     *
+     * @return false = 거부됨 (OverflowPolicy::Reject), 부모는 원래대로
+     *         → 호출자가 func를 직접 실행하면 됨
      */
-    void schedule(Job* job);
+    template <typename F>
+    bool schedule_child(Job* parent, F&& func);
     
     // ========================================
     // TODO: 대기 API
@@ -390,6 +525,36 @@ public:
         return pending_jobs_.load(std::memory_order_relaxed);
     }
     
+    /**
+     * Job 분배 방식
+     */
+    SchedulerMode mode() const {
+        return mode_;
+    }
+
+    /**
+     * 공유 큐가 가득 찼을 때의 동작
+     */
+    OverflowPolicy overflow_policy() const {
+        return overflow_policy_;
+    }
+
+    /**
+     * 공유 큐가 가득 차서 넘침 정책이 동작한 횟수
+     */
+    std::size_t overflow_count() const {
+        return overflow_count_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * 지금 Job을 더 만들면 누군가 가져갈지 (근사값, 게으른 분할용)
+     *
+     * 호출 스레드가 Job을 넣을 큐(WorkStealing 워커면 자기 deque,
+     * 아니면 공유 큐)가 비어 있으면 true → 그 큐의 Job은 이미 다 가져갔음
+     * = 일을 찾는 워커가 있을 수 있음
+     */
+    bool has_demand() const;
+
     /**
      * 실행 중인지?
      */
@@ -440,9 +605,36 @@ private:
     /**
      * Job 큐에서 Job 가져오기
      * 
+     * WorkStealing 모드: 자기 deque → 공유 큐 → 다른 워커에게서 훔치기
+     *
      * @return 가져온 Job, 큐가 비었으면 nullptr
      */
     Job* try_get_job();
+
+    /**
+     * 무작위 victim부터 돌며 한 번씩 steal (WorkStealing 모드)
+     *
+     * @param self 호출한 워커 ID (외부 스레드면 워커 수 → 건너뛸 deque 없음)
+     */
+    Job* try_steal_job(std::size_t self);
+
+    /**
+     * 넘친 Job 보조 큐에서 꺼내기 (Spill 정책일 때만)
+     */
+    bool try_pop_overflow(Job*& job);
+
+    /**
+     * 공유 큐가 가득 찼을 때 overflow_policy_에 따라 처리
+     *
+     * @return false = 거부됨 (pending_jobs_는 되돌려 놓음)
+     */
+    bool handle_overflow(Job* job);
+
+    /**
+     * 현재 스레드가 이 JobSystem의 워커면 그 ID, 아니면 local_queues_ 크기
+     * (공유 큐 모드에서는 항상 0 → "로컬 deque 없음")
+     */
+    std::size_t current_worker_id() const;
     
     /**
      * Job 실행
@@ -457,11 +649,12 @@ private:
      * @param job 완료된 Job
      * 
      * 알고리즘:
-     * 1. counter가 있으면 decrement()
-     * 2. parent가 있으면 parent->unfinished_jobs 감소
-     * 3. unfinished_jobs == 0 이면:
+     * 1. unfinished_jobs 감소 (자기 함수 또는 자식 하나가 끝남)
+     * 2. unfinished_jobs == 0 이면 (자기 함수 + 모든 자식 완료):
+     *    - counter가 있으면 decrement()
      *    - Job 메모리 반환
      *    - pending_jobs_ 감소
+     *    - parent가 있으면 finish(parent)
      */
     void finish(Job* job);
     
@@ -481,14 +674,40 @@ private:
 // ========================================
 
 template <typename F>
-void JobSystem::schedule(F&& func, Counter* counter) {
+bool JobSystem::schedule(F&& func, Counter* counter) {
     Job* job = job_pool_.construct(std::forward<F>(func), counter);
-    if (job) {
+    if (!job) {
+        return false;
+    }
+    if (counter) {
+        counter->increment();
+    }
+    if (!schedule(job)) {
+        // 거부됨 → 없었던 일로
         if (counter) {
-            counter->increment();
+            counter->decrement();
         }
-        schedule(job);
+        job_pool_.destroy(job);
+        return false;
+    }
+    return true;
+}
+
+template <typename F>
+bool JobSystem::schedule_child(Job* parent, F&& func) {
+    Job* job = job_pool_.construct(std::forward<F>(func), nullptr, parent);
+    if (!job) {
+        return false;
     }
+    // 예약 전에 올려야 자식이 먼저 끝나도 부모가 조기 완료되지 않음
+    parent->unfinished_jobs.fetch_add(1, std::memory_order_relaxed);
+    if (!schedule(job)) {
+        // 부모는 아직 자기 몫(1)을 들고 있으므로 여기서 0이 되지 않음
+        parent->unfinished_jobs.fetch_sub(1, std::memory_order_relaxed);
+        job_pool_.destroy(job);
+        return false;
+    }
+    return true;
 }
 
 // ========================================
@@ -499,3 +718,7 @@ void JobSystem::schedule(F&& func, Counter* counter) {
 // 직접 구현해보세요!
 
 } // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
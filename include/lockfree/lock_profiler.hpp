@@ -0,0 +1,362 @@
+/**
+ * Lock Profiler - 어느 SpinLock이 뜨거운지 (mutrace 스타일)
+ *
+ * 경합 문제를 추적할 때 가장 먼저 알고 싶은 것:
+ *   "수백 개 락 중 어느 락에서 스레드들이 기다리는가?"
+ *
+ * 켜는 방법 (컴파일 타임 스위치):
+ *   cmake -DLOCKFREE_LOCK_PROFILING=ON ..
+ *   → 모든 타깃에 LOCKFREE_LOCK_PROFILING 매크로 정의
+ *   (프로그램 전체가 같은 설정이어야 함 - SpinLock 크기가 달라짐)
+ *
+ * 꺼져 있으면 (기본값):
+ *   SpinLock 안의 훅은 빈 구조체 + 빈 inline 함수 → 코드/크기 변화 0
+ *
+ * 켜져 있으면 락마다 기록:
+ * ┌──────────────────┬──────────────────────────────────────────┐
+ * │  acquisitions    │  획득 횟수                                │
+ * │  contended       │  fast path에서 실패한 획득 횟수            │
+ * │  spin_iterations │  스핀 단계에서 pause한 총 횟수             │
+ * │  slow_path       │  futex 대기(lock_slow_path)로 간 횟수      │
+ * │  wait_cycles     │  경합 획득에서 기다린 총 TSC 사이클         │
+ * │  hold_cycles     │  락을 쥐고 있던 총 TSC 사이클              │
+ * └──────────────────┴──────────────────────────────────────────┘
+ *
+ * 통계는 "락을 쥔 스레드"만 갱신 → 락 자체가 직렬화해 줌
+ * → atomic RMW 없이 relaxed load + store (보고용 스레드가 읽어도 안전)
+ *
+ * 사용 예:
+ *   SpinLock queue_lock("render-queue");
+ *   ...
+ *   LockProfiler::instance().dump_top(std::cerr, 10);
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>  // __rdtsc()
+#endif
+
+namespace lockfree {
+
+/**
+ * 사이클 카운터 (x86: rdtsc, ARM64: 가상 카운터, 그 외: steady_clock ns)
+ *
+ * rdtsc는 직렬화 명령이 아님 → 수십 사이클 오차 (통계용으로 충분)
+ */
+inline std::uint64_t read_cycle_counter() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    std::uint64_t value;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/**
+ * 락 하나의 통계 (락 객체 안에 있음)
+ */
+struct LockStats {
+    const char* name = nullptr;
+    const void* address = nullptr;
+
+    std::atomic<std::uint64_t> acquisitions{0};
+    std::atomic<std::uint64_t> contended{0};
+    std::atomic<std::uint64_t> spin_iterations{0};
+    std::atomic<std::uint64_t> slow_path{0};
+    std::atomic<std::uint64_t> wait_cycles{0};
+    std::atomic<std::uint64_t> hold_cycles{0};
+
+    // 현재 보유 시작 시각 (보유자만 접근)
+    std::uint64_t hold_start = 0;
+};
+
+/**
+ * 보고용 복사본
+ */
+struct LockStatsSnapshot {
+    std::string name;
+    const void* address = nullptr;
+    std::uint64_t acquisitions = 0;
+    std::uint64_t contended = 0;
+    std::uint64_t spin_iterations = 0;
+    std::uint64_t slow_path = 0;
+    std::uint64_t wait_cycles = 0;
+    std::uint64_t hold_cycles = 0;
+    bool destroyed = false;  // 이미 소멸한 락 (소멸 시점의 값)
+};
+
+// ============================================
+// 전역 레지스트리
+// ============================================
+// 락 생성/소멸과 보고 때만 접근 (뜨거운 경로 아님) → std::mutex로 충분
+class LockProfiler {
+public:
+    enum class SortBy {
+        WaitCycles,
+        Contended,
+        Acquisitions,
+        HoldCycles
+    };
+
+#ifdef LOCKFREE_LOCK_PROFILING
+    static constexpr bool enabled = true;
+#else
+    static constexpr bool enabled = false;
+#endif
+
+    /**
+     * 프로세스 전역 인스턴스
+     *
+     * 일부러 소멸시키지 않음: static SpinLock이 레지스트리보다 늦게 소멸해도 안전
+     */
+    static LockProfiler& instance() {
+        static LockProfiler* profiler = new LockProfiler();
+        return *profiler;
+    }
+
+    void register_lock(LockStats* stats) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        live_.push_back(stats);
+    }
+
+    /**
+     * 소멸하는 락 제거 (사용된 적 있으면 마지막 값을 보관 → 보고에 포함)
+     */
+    void unregister_lock(LockStats* stats) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = std::find(live_.begin(), live_.end(), stats);
+        if (it != live_.end()) {
+            live_.erase(it);
+        }
+        if (stats->acquisitions.load(std::memory_order_relaxed) > 0) {
+            LockStatsSnapshot snap = make_snapshot(*stats);
+            snap.destroyed = true;
+            retired_.push_back(std::move(snap));
+        }
+    }
+
+    /**
+     * 살아 있는 락 + 소멸한 락 전체
+     */
+    std::vector<LockStatsSnapshot> snapshot() const {
+        std::lock_guard<std::mutex> guard(mutex_);
+        std::vector<LockStatsSnapshot> result = retired_;
+        result.reserve(result.size() + live_.size());
+        for (const LockStats* stats : live_) {
+            result.push_back(make_snapshot(*stats));
+        }
+        return result;
+    }
+
+    /**
+     * 기준값이 큰 순서로 n개
+     */
+    std::vector<LockStatsSnapshot> top(std::size_t n, SortBy by = SortBy::WaitCycles) const {
+        std::vector<LockStatsSnapshot> all = snapshot();
+        auto key = [by](const LockStatsSnapshot& s) {
+            switch (by) {
+                case SortBy::Contended:    return s.contended;
+                case SortBy::Acquisitions: return s.acquisitions;
+                case SortBy::HoldCycles:   return s.hold_cycles;
+                case SortBy::WaitCycles:   break;
+            }
+            return s.wait_cycles;
+        };
+        std::stable_sort(all.begin(), all.end(), [&](const auto& a, const auto& b) {
+            return key(a) > key(b);
+        });
+        if (all.size() > n) {
+            all.resize(n);
+        }
+        return all;
+    }
+
+    /**
+     * 상위 n개 락을 표로 출력
+     */
+    void dump_top(std::ostream& os, std::size_t n = 10, SortBy by = SortBy::WaitCycles) const {
+        if (!enabled) {
+            os << "lock profiling disabled (build with LOCKFREE_LOCK_PROFILING)\n";
+            return;
+        }
+
+        std::vector<LockStatsSnapshot> rows = top(n, by);
+        os << "Top " << rows.size() << " locks:\n";
+        os << std::left << std::setw(24) << "name"
+           << std::right
+           << std::setw(12) << "acquired"
+           << std::setw(12) << "contended"
+           << std::setw(8) << "cont%"
+           << std::setw(14) << "spins"
+           << std::setw(10) << "slow"
+           << std::setw(16) << "wait(cyc)"
+           << std::setw(16) << "hold(cyc)"
+           << std::setw(12) << "avg hold"
+           << '\n';
+
+        for (const auto& row : rows) {
+            std::string label = row.name.empty() ? "<unnamed>" : row.name;
+            if (row.destroyed) {
+                label += " (dead)";
+            }
+            double contended_pct = row.acquisitions
+                ? 100.0 * static_cast<double>(row.contended) / static_cast<double>(row.acquisitions)
+                : 0.0;
+            std::uint64_t avg_hold = row.acquisitions ? row.hold_cycles / row.acquisitions : 0;
+
+            os << std::left << std::setw(24) << label
+               << std::right
+               << std::setw(12) << row.acquisitions
+               << std::setw(12) << row.contended
+               << std::setw(7) << std::fixed << std::setprecision(1) << contended_pct << '%'
+               << std::setw(14) << row.spin_iterations
+               << std::setw(10) << row.slow_path
+               << std::setw(16) << row.wait_cycles
+               << std::setw(16) << row.hold_cycles
+               << std::setw(12) << avg_hold
+               << '\n';
+        }
+    }
+
+    /**
+     * 모든 통계 초기화 (측정 구간을 나눌 때)
+     *
+     * 다른 스레드가 락을 쓰는 중이면 그 갱신 하나 정도는 섞일 수 있음
+     */
+    void reset() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        retired_.clear();
+        for (LockStats* stats : live_) {
+            stats->acquisitions.store(0, std::memory_order_relaxed);
+            stats->contended.store(0, std::memory_order_relaxed);
+            stats->spin_iterations.store(0, std::memory_order_relaxed);
+            stats->slow_path.store(0, std::memory_order_relaxed);
+            stats->wait_cycles.store(0, std::memory_order_relaxed);
+            stats->hold_cycles.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    LockProfiler() = default;
+
+    static LockStatsSnapshot make_snapshot(const LockStats& stats) {
+        LockStatsSnapshot snap;
+        snap.name = stats.name ? stats.name : "";
+        snap.address = stats.address;
+        snap.acquisitions = stats.acquisitions.load(std::memory_order_relaxed);
+        snap.contended = stats.contended.load(std::memory_order_relaxed);
+        snap.spin_iterations = stats.spin_iterations.load(std::memory_order_relaxed);
+        snap.slow_path = stats.slow_path.load(std::memory_order_relaxed);
+        snap.wait_cycles = stats.wait_cycles.load(std::memory_order_relaxed);
+        snap.hold_cycles = stats.hold_cycles.load(std::memory_order_relaxed);
+        return snap;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<LockStats*> live_;
+    std::vector<LockStatsSnapshot> retired_;
+};
+
+namespace detail {
+
+// ============================================
+// SpinLock 안에 들어가는 훅
+// ============================================
+
+/**
+ * 프로파일링 꺼짐: 모든 함수가 비어 있음 → 인라인 후 완전히 사라짐
+ */
+struct NullLockProfile {
+    constexpr explicit NullLockProfile(const char* /*name*/ = nullptr, const void* /*address*/ = nullptr) {}
+
+    static constexpr std::uint64_t now() { return 0; }
+    constexpr void on_acquired() {}
+    constexpr void on_acquired(std::uint64_t /*wait_start*/, std::uint32_t /*spins*/, bool /*slow_path*/) {}
+    constexpr void on_release() {}
+};
+
+/**
+ * 프로파일링 켜짐: 락마다 LockStats를 보유하고 레지스트리에 등록
+ *
+ * on_acquired/on_release는 락을 쥔 상태에서만 호출됨
+ */
+class LockProfile {
+public:
+    explicit LockProfile(const char* name = nullptr, const void* address = nullptr) {
+        stats_.name = name;
+        stats_.address = address;
+        LockProfiler::instance().register_lock(&stats_);
+    }
+
+    ~LockProfile() {
+        LockProfiler::instance().unregister_lock(&stats_);
+    }
+
+    LockProfile(const LockProfile&) = delete;
+    LockProfile& operator=(const LockProfile&) = delete;
+
+    static std::uint64_t now() { return read_cycle_counter(); }
+
+    // 경합 없이 획득 (fast path, try_lock)
+    void on_acquired() {
+        bump(stats_.acquisitions, 1);
+        stats_.hold_start = now();
+    }
+
+    // 경합 후 획득
+    void on_acquired(std::uint64_t wait_start, std::uint32_t spins, bool slow_path) {
+        std::uint64_t t = now();
+        bump(stats_.acquisitions, 1);
+        bump(stats_.contended, 1);
+        bump(stats_.spin_iterations, spins);
+        if (slow_path) {
+            bump(stats_.slow_path, 1);
+        }
+        bump(stats_.wait_cycles, t - wait_start);
+        stats_.hold_start = t;
+    }
+
+    void on_release() {
+        bump(stats_.hold_cycles, now() - stats_.hold_start);
+    }
+
+    const LockStats& stats() const { return stats_; }
+
+private:
+    // 보유자만 쓰므로 load + store로 충분 (RMW 불필요)
+    static void bump(std::atomic<std::uint64_t>& counter, std::uint64_t delta) {
+        counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    LockStats stats_;
+};
+
+#ifdef LOCKFREE_LOCK_PROFILING
+using SpinLockProfile = LockProfile;
+#else
+using SpinLockProfile = NullLockProfile;
+#endif
+
+} // namespace detail
+
+} // namespace lockfree
@@ -0,0 +1,308 @@
+/**
+ * MCS Lock - Queue-Based Spinlock (Mellor-Crummey & Scott)
+ *
+ * SpinLock은 모든 대기자가 같은 locked_ 캐시라인을 스핀함
+ * → unlock 순간 모든 스피너가 동시에 달려듦 (cache line stampede)
+ * → 2-소켓 머신에서는 인터커넥트를 오가며 치명적!
+ *
+ * MCS Lock 핵심 아이디어:
+ *   - 각 대기자는 "자기 자신의" 큐 노드만 스핀
+ *   - tail_ 하나만 공유 → 대기열에 들어갈 때 exchange 한 번
+ *   - unlock은 다음 대기자의 노드 하나만 건드림
+ *     → handoff 당 캐시라인 전송 1회, FIFO 순서 보장
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  tail_ ─────────────────────────────────────┐               │
+ * │                                              ▼               │
+ * │  [Node A] ──next──► [Node B] ──next──► [Node C]             │
+ * │  (holder)           spin on B.state      spin on C.state    │
+ * │                                                              │
+ * │  A.unlock(): B.state = GRANTED  (B의 캐시라인만 무효화)       │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * 잠든 대기자:
+ *   오래 기다리면 노드를 SLEEPING으로 바꾸고 락이 소유한 wake_seq_ 위에서 OS 대기
+ *   (노드 위에서 대기하면: 넘겨받은 대기자가 unlock 후 노드를 파괴한 뒤에
+ *    넘겨준 쪽의 notify가 그 노드를 건드릴 수 있음)
+ *   → unlock이 후속자 노드를 건드리는 마지막 연산은 state exchange 하나
+ *
+ * 노드 제공 방식:
+ *   1. 호출자 제공: lock(node) / unlock(node) - 노드는 unlock까지 살아있어야 함
+ *   2. thread-local: lock() / unlock() - BasicLockable (std::lock_guard 호환)
+ *      → 같은 스레드에서 lock/unlock 해야 함 (thread-oblivious 아님)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cassert>
+
+#include "backoff.hpp"  // SPIN_PAUSE()
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lockfree {
+
+/**
+ * MCS 큐 노드
+ *
+ * 대기자마다 하나씩, 자기 캐시라인에 위치
+ * (이웃 노드와 false sharing 방지)
+ */
+struct alignas(64) MCSNode {
+    std::atomic<MCSNode*> next{nullptr};
+
+    /**
+     * 대기 상태
+     *
+     * GRANTED  (0): 락 획득 (선행자가 넘겨줌)
+     * WAITING  (1): 스핀 중
+     * SLEEPING (2): OS 대기 중 → 넘겨줄 때 락의 wake_seq_로 깨워야 함
+     *
+     * 32비트: Linux futex가 직접 대기할 수 있는 크기
+     */
+    std::atomic<std::uint32_t> state{0};
+};
+
+class MCSLock {
+public:
+    // 한 스레드가 동시에 잡을 수 있는 MCS 락 수 (thread-local 노드 개수)
+    static constexpr std::uint32_t MAX_HELD_PER_THREAD = 8;
+
+    MCSLock() = default;
+
+    ~MCSLock() {
+        assert(tail_.load(std::memory_order_relaxed) == nullptr && "MCSLock destroyed while held");
+    }
+
+    // Non-copyable, non-movable
+    MCSLock(const MCSLock&) = delete;
+    MCSLock& operator=(const MCSLock&) = delete;
+    MCSLock(MCSLock&&) = delete;
+    MCSLock& operator=(MCSLock&&) = delete;
+
+    // ============================================
+    // 호출자 제공 노드 API
+    // ============================================
+
+    void lock(MCSNode& node) {
+        node.next.store(nullptr, std::memory_order_relaxed);
+        node.state.store(WAITING, std::memory_order_relaxed);
+
+        // 대기열 맨 뒤에 합류 (공유 캐시라인에 쓰는 유일한 연산)
+        // acq_rel: 선행자의 노드 초기화를 보고, 내 노드 초기화를 보여줌
+        MCSNode* pred = tail_.exchange(&node, std::memory_order_acq_rel);
+        if (pred == nullptr) {
+            return;  // 대기열이 비어 있었음 → 즉시 획득
+        }
+
+        // 선행자에게 나를 연결 → 선행자가 unlock 시 나를 깨움
+        pred->next.store(&node, std::memory_order_release);
+
+        // 내 노드만 스핀 (다른 대기자와 캐시라인 공유 없음)
+        for (int spin = 0; spin < spin_count_; ++spin) {
+            if (node.state.load(std::memory_order_acquire) == GRANTED) {
+                return;
+            }
+            SPIN_PAUSE();
+        }
+
+        lock_slow_path(node);
+    }
+
+    bool try_lock(MCSNode& node) {
+        node.next.store(nullptr, std::memory_order_relaxed);
+        node.state.store(WAITING, std::memory_order_relaxed);
+
+        // 대기열이 비어 있을 때만 진입
+        MCSNode* expected = nullptr;
+        return tail_.compare_exchange_strong(
+            expected,
+            &node,
+            std::memory_order_acquire,
+            std::memory_order_relaxed
+        );
+    }
+
+    void unlock(MCSNode& node) {
+        MCSNode* succ = node.next.load(std::memory_order_acquire);
+
+        if (succ == nullptr) {
+            // 후속자가 없어 보임 → tail_을 비워서 해제 시도
+            MCSNode* expected = &node;
+            if (tail_.compare_exchange_strong(
+                    expected,
+                    nullptr,
+                    std::memory_order_release,
+                    std::memory_order_relaxed)) {
+                return;
+            }
+
+            // CAS 실패 = 누군가 exchange는 했지만 아직 next를 연결하지 못함
+            // 연결될 때까지 잠깐 기다림 (exchange와 store 사이의 짧은 창)
+            while ((succ = node.next.load(std::memory_order_acquire)) == nullptr) {
+                SPIN_PAUSE();
+            }
+        }
+
+        // 후속자 노드 하나에만 쓰기 → 캐시라인 전송 1회
+        // 이 exchange 뒤로는 succ를 건드리지 않음 (후속자가 곧바로 노드를 파괴할 수 있음)
+        // 후속자가 OS 대기 중일 때만 락 소유의 wake_seq_로 깨움 (스핀 중이면 시스템 콜 없음)
+        // seq_cst: lock_slow_path의 "wake_seq_ 읽기 → state 읽기"와 전순서 → 깨움 유실 없음
+        if (succ->state.exchange(GRANTED, std::memory_order_seq_cst) == SLEEPING) {
+            wake_seq_.fetch_add(1, std::memory_order_seq_cst);
+            wake_seq_.notify_all();
+        }
+    }
+
+    // ============================================
+    // thread-local 노드 API (BasicLockable)
+    // ============================================
+
+    void lock() {
+        MCSNode* node = acquire_local_node();
+        lock(*node);
+        holder_ = node;  // 락 보유 중에만 접근 → 별도 동기화 불필요
+    }
+
+    bool try_lock() {
+        MCSNode* node = acquire_local_node();
+        if (try_lock(*node)) {
+            holder_ = node;
+            return true;
+        }
+        release_local_node(node);
+        return false;
+    }
+
+    void unlock() {
+        MCSNode* node = holder_;
+        assert(node != nullptr && "unlock() without matching lock()");
+        holder_ = nullptr;
+        unlock(*node);
+        release_local_node(node);
+    }
+
+    /**
+     * 락이 잡혀 있는지 (디버깅/통계용, 근사값)
+     */
+    bool is_locked() const {
+        return tail_.load(std::memory_order_relaxed) != nullptr;
+    }
+
+private:
+    static constexpr std::uint32_t GRANTED = 0;
+    static constexpr std::uint32_t WAITING = 1;
+    static constexpr std::uint32_t SLEEPING = 2;
+
+    // Slow path: OS 레벨 대기 (SpinLock::lock_slow_path와 같은 역할)
+    // 대기는 락이 소유한 wake_seq_ 위에서 → 넘겨준 쪽의 notify가 내 노드를 건드리지 않음
+    void lock_slow_path(MCSNode& node) {
+        std::uint32_t expected = WAITING;
+
+        // WAITING → SLEEPING: 선행자에게 "notify 필요"를 알림
+        // 실패했다면 이미 GRANTED로 바뀐 것
+        if (!node.state.compare_exchange_strong(
+                expected,
+                SLEEPING,
+                std::memory_order_acquire,
+                std::memory_order_acquire)) {
+            return;
+        }
+
+        for (;;) {
+            // wake_seq_를 먼저 읽고 state 확인 → 그 사이에 넘겨받았으면 seq가 바뀌어 wait가 즉시 반환
+            std::uint32_t seq = wake_seq_.load(std::memory_order_seq_cst);
+            if (node.state.load(std::memory_order_seq_cst) == GRANTED) {
+                return;
+            }
+            wake_seq_.wait(seq, std::memory_order_seq_cst);
+        }
+    }
+
+    /**
+     * 스레드별 노드 묶음
+     *
+     * 여러 MCS 락을 동시에 잡을 수 있도록 노드를 여러 개 보유
+     * (락마다 서로 다른 노드가 필요)
+     */
+    struct LocalNodes {
+        MCSNode nodes[MAX_HELD_PER_THREAD];
+        std::uint32_t used_mask = 0;
+    };
+
+    static LocalNodes& local_nodes() {
+        thread_local LocalNodes nodes;
+        return nodes;
+    }
+
+    static MCSNode* acquire_local_node() {
+        LocalNodes& ln = local_nodes();
+        for (std::uint32_t i = 0; i < MAX_HELD_PER_THREAD; ++i) {
+            if ((ln.used_mask & (1u << i)) == 0) {
+                ln.used_mask |= (1u << i);
+                return &ln.nodes[i];
+            }
+        }
+        assert(false && "Too many MCSLocks held by one thread");
+        return nullptr;
+    }
+
+    static void release_local_node(MCSNode* node) {
+        LocalNodes& ln = local_nodes();
+        auto index = static_cast<std::uint32_t>(node - ln.nodes);
+        assert(index < MAX_HELD_PER_THREAD && "MCSLock unlocked from a different thread");
+        ln.used_mask &= ~(1u << index);
+    }
+
+private:
+    // 대기열 꼬리 (모든 스레드가 공유하는 유일한 캐시라인)
+    alignas(64) std::atomic<MCSNode*> tail_{nullptr};
+
+    // 현재 보유자의 thread-local 노드 (lock()/unlock() 전용)
+    MCSNode* holder_{nullptr};
+
+    // 잠든 대기자를 깨우는 단어 (노드가 아니라 락이 소유 → unlock 후에도 유효)
+    // 잠든 대기자끼리 공유: notify_all 후 자기 노드가 GRANTED가 아니면 다시 잠듦
+    std::atomic<std::uint32_t> wake_seq_{0};
+
+    // 스핀 횟수 (SpinLock과 동일하게 튜닝 가능)
+    static constexpr int spin_count_ = 32;
+};
+
+// ============================================
+// RAII wrapper for MCSLock
+// ============================================
+// 노드를 가드 안에 직접 보유 → thread-local 노드 개수 제한 없음
+// 가드 객체 자체가 대기열 노드이므로 스택 위에서만 사용
+class MCSLockGuard {
+public:
+    explicit MCSLockGuard(MCSLock& lock) : lock_(lock) {
+        lock_.lock(node_);
+    }
+
+    ~MCSLockGuard() {
+        lock_.unlock(node_);
+    }
+
+    // Non-copyable, non-movable
+    MCSLockGuard(const MCSLockGuard&) = delete;
+    MCSLockGuard& operator=(const MCSLockGuard&) = delete;
+    MCSLockGuard(MCSLockGuard&&) = delete;
+    MCSLockGuard& operator=(MCSLockGuard&&) = delete;
+
+private:
+    MCSLock& lock_;
+    MCSNode node_;
+};
+
+} // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
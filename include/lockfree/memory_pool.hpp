@@ -35,6 +35,9 @@
 #include <memory>
 #include <vector>
 #include <cassert>
+#include <utility>
+
+#include "tagged_ptr.hpp"
 
 namespace lockfree {
 
@@ -72,94 +75,6 @@ private:
         FreeNode* next;
     };
     
-    /**
-     * Tagged Pointer (ABA 문제 해결) - 64비트 버전
-     * 
-     * ┌─────────────────────────────────────────────────────────────┐
-     * │  왜 64비트여야 하는가?                                        │
-     * │                                                              │
-     * │  문제: 16바이트(128비트) TaggedPtr                            │
-     * │  ┌────────────────────────────────────────┐                 │
-     * │  │ ptr (8바이트) │ tag (8바이트)           │ = 16바이트      │
-     * │  └────────────────────────────────────────┘                 │
-     * │                                                              │
-     * │  - x86-64에서 128비트 CAS는 CMPXCHG16B 명령어 필요           │
-     * │  - 모든 CPU가 지원하지 않음 → 내부적으로 mutex 사용!          │
-     * │  - Lock-Free가 아니게 됨!                                     │
-     * │                                                              │
-     * │  해결: 64비트에 포인터 + 태그 패킹                            │
-     * │  ┌────────────────────────────────────────┐                 │
-     * │  │ tag (16비트) │ pointer (48비트)         │ = 8바이트       │
-     * │  └────────────────────────────────────────┘                 │
-     * │                                                              │
-     * │  - x86-64 가상 주소는 48비트만 사용 (현재)                    │
-     * │  - 상위 16비트를 태그로 활용 가능!                            │
-     * │  - 64비트 CAS는 모든 x86-64에서 lock-free!                   │
-     * └─────────────────────────────────────────────────────────────┘
-     * 
-     * 포인터 + 태그를 단일 64비트 값에 패킹:
-     *   - 하위 48비트: 포인터 주소
-     *   - 상위 16비트: 버전 태그 (0 ~ 65535)
-     * 
-     * 비트 레이아웃:
-     *   [63 ─ 48][47 ─────────────────────────────── 0]
-     *   │  tag   │              pointer               │
-     *   └────────┴────────────────────────────────────┘
-     * 
-     * ABA 방지 원리:
-     *   A(tag=0) → B → C
-     *   A가 pop되고 다시 push되면 A(tag=1)
-     *   CAS(A(tag=0), ...) 실패! (태그 불일치)
-     * 
-     * 주의사항:
-     *   - x86-64 canonical address: 48비트 사용 (현재)
-     *   - 5-level paging 활성화 시 57비트 사용 → 태그 비트 감소 필요
-     *   - ARM64도 유사하게 48비트 또는 52비트 주소 사용
-     */
-    class TaggedPtr {
-    private:
-        // 64비트 단일 값으로 포인터와 태그를 함께 저장
-        std::uint64_t value_;
-        
-        // 비트 마스크 상수
-        static constexpr std::uint64_t PTR_MASK = 0x0000FFFFFFFFFFFF; // 하위 48비트
-        static constexpr std::uint64_t TAG_MASK = 0xFFFF000000000000; // 상위 16비트
-        static constexpr int TAG_SHIFT = 48;
-        
-    public:
-        // 기본 생성자
-        TaggedPtr() : value_(0) {}
-        
-        // 포인터 + 태그로 생성
-        TaggedPtr(FreeNode* ptr, std::uint16_t tag) {
-            std::uint64_t ptr_val = reinterpret_cast<std::uint64_t>(ptr) & PTR_MASK;
-            std::uint64_t tag_val = static_cast<std::uint64_t>(tag) << TAG_SHIFT;
-            value_ = ptr_val | tag_val;
-        }
-        
-        // 포인터 추출
-        FreeNode* ptr() const {
-            return reinterpret_cast<FreeNode*>(value_ & PTR_MASK);
-        }
-        
-        // 태그 추출
-        std::uint16_t tag() const {
-            return static_cast<std::uint16_t>((value_ & TAG_MASK) >> TAG_SHIFT);
-        }
-        
-        // 비교 연산자 (atomic CAS에서 사용)
-        bool operator==(const TaggedPtr& other) const {
-            return value_ == other.value_;
-        }
-        
-        bool operator!=(const TaggedPtr& other) const {
-            return value_ != other.value_;
-        }
-    };
-    
-    // 컴파일 타임 검증: TaggedPtr이 정확히 8바이트(64비트)인지 확인
-    static_assert(sizeof(TaggedPtr) == 8, "TaggedPtr must be exactly 64 bits for lock-free CAS");
-    
     /**
      * 블록 정렬 (먼저 계산)
      * 
@@ -242,14 +157,14 @@ private:
     /**
      * Free List Head (Tagged Pointer)
      * 
-     * Lock-Free push/pop을 위한 atomic 포인터
-     * TaggedPtr로 ABA 문제 해결!
+     * Lock-Free push/pop을 위한 (포인터, 태그) atomic 쌍
+     * 태그로 ABA 문제 해결! (tagged_ptr.hpp)
      * 
-     * 왜 atomic이어야 하는가?
-     * - 여러 스레드가 동시에 read/write
-     * - CAS 연산을 위해 필수
+     * 저장 방식:
+     * - 128비트 CAS 가능: 64비트 포인터 + 64비트 태그 (태그 wrap 없음)
+     * - 불가능: 48비트 포인터 + 16비트 태그로 패킹 (주소 폭 런타임 검사)
      */
-    std::atomic<TaggedPtr> free_list_{TaggedPtr{nullptr, 0}};
+    AtomicTaggedPtr<FreeNode> free_list_;
     
     /**
      * 메모리 청크 목록
@@ -391,6 +306,53 @@ public:
         }
     }
 
+    /**
+     * 여러 블록을 한꺼번에 해제
+     *
+     * 블록끼리 먼저 로컬에서 연결한 뒤 free list에 CAS 한 번으로 붙임
+     * (EBR limbo 목록 등 묶음 회수에서 블록당 CAS를 없앰)
+     *
+     * @param ptrs  반환할 포인터 배열 (T*로 static_cast 가능한 타입, 예: 노드 기반 클래스)
+     * @param count 배열 길이
+     */
+    template <typename Ptr>
+    void deallocate_bulk(Ptr const* ptrs, std::size_t count) {
+        FreeNode* first = nullptr;
+        FreeNode* last = nullptr;
+        std::size_t linked = 0;
+
+        for (std::size_t i = 0; i < count; ++i) {
+            T* ptr = static_cast<T*>(ptrs[i]);
+            if (ptr == nullptr) continue;
+            FreeNode* node = reinterpret_cast<FreeNode*>(ptr);
+            node->next = first;
+            first = node;
+            if (last == nullptr) {
+                last = node;
+            }
+            ++linked;
+        }
+
+        if (first != nullptr) {
+            push_free_chain(first, last);
+            allocated_count_.fetch_sub(linked, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * 여러 객체의 소멸자 호출 + 한꺼번에 해제
+     */
+    template <typename Ptr>
+    void destroy_bulk(Ptr const* ptrs, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            T* ptr = static_cast<T*>(ptrs[i]);
+            if (ptr) {
+                ptr->~T();
+            }
+        }
+        deallocate_bulk(ptrs, count);
+    }
+
     // ========================================
     // 유틸리티
     // ========================================
@@ -443,14 +405,13 @@ public:
     /**
      * Lock-Free 여부
      * 
-     * TaggedPtr이 64비트이므로:
-     * - x86-64: 항상 Lock-Free (CMPXCHG8B/CMPXCHG 사용)
-     * - ARM64: 항상 Lock-Free (LDXR/STXR 사용)
+     * AtomicTaggedPtr은 lock-free인 방식만 선택됨:
+     * - 128비트 CAS (x86-64 CMPXCHG16B, ARM64 LDXP/STXP)
+     * - 또는 64비트 CAS에 패킹 (x86-64 CMPXCHG, ARM64 LDXR/STXR)
      * - 32비트 시스템: Lock-Free 보장 안 됨
      */
     static bool is_lock_free() {
-        static_assert(sizeof(TaggedPtr) == 8, "TaggedPtr must be 64 bits");
-        return std::atomic<TaggedPtr>::is_always_lock_free;
+        return AtomicTaggedPtr<FreeNode>::is_always_lock_free;
     }
 
 private:
@@ -479,21 +440,25 @@ private:
      * 
      * 알고리즘:
      *   1. 스핀락으로 chunks_ 벡터 보호
-     *   2. 새 Chunk 생성 및 추가
+     *   2. 새 Chunk 생성 및 추가, 락 안에서 블록 시작 주소 읽기
      *   3. 청크의 모든 블록을 free list에 push
      *   4. total_blocks_ 업데이트
      * 
+     * 락을 푼 뒤에는 Chunk&를 쓰지 않음:
+     *   다른 스레드의 emplace_back이 벡터를 재할당하면 참조가 무효화됨
+     *   (블록 메모리 자체는 unique_ptr이 들고 있어 이동해도 주소 유지)
+     * 
      * @param block_count 청크의 블록 수
      * 
      */
     void add_chunk(std::size_t block_count) {
         acquire_chunks_lock();
         chunks_.emplace_back(block_count);
-        Chunk& new_chunk = chunks_.back();
+        std::byte* blocks = chunks_.back().aligned_start();
         release_chunks_lock();
         
         for (std::size_t i = 0; i < block_count; ++i) {
-            void* block_ptr = new_chunk.block_at(i);
+            void* block_ptr = blocks + i * BLOCK_SIZE;
             push_free_node(reinterpret_cast<FreeNode*>(block_ptr));
         }
         
@@ -510,18 +475,19 @@ private:
      * @return 꺼낸 노드, 비어있으면 nullptr
      */
     FreeNode* pop_free_node() {
-        TaggedPtr old_head = free_list_.load(std::memory_order_relaxed);
+        // acquire: push한 쪽이 쓴 next를 봄
+        TaggedPtr<FreeNode> old_head = free_list_.load(std::memory_order_acquire);
         
         while (old_head.ptr() != nullptr) {
             // 새 head: 다음 노드 + 태그 증가
-            TaggedPtr new_head{old_head.ptr()->next, 
-                              static_cast<std::uint16_t>(old_head.tag() + 1)};
+            // (블록 메모리는 풀이 끝날 때까지 유지 → 낡은 head의 next 읽기도 안전, CAS가 거름)
+            TaggedPtr<FreeNode> new_head = old_head.advanced(old_head.ptr()->next);
             
             if (free_list_.compare_exchange_weak(
-                old_head,   // expected (64비트 전체가 일치해야 성공)
+                old_head,   // expected (포인터 + 태그 전체가 일치해야 성공)
                 new_head,   // desired
                 std::memory_order_acquire,
-                std::memory_order_relaxed
+                std::memory_order_acquire
             )) {
                 return old_head.ptr();
             }
@@ -540,14 +506,26 @@ private:
      * @param node 추가할 노드
      */
     void push_free_node(FreeNode* node) {
-        TaggedPtr old_head = free_list_.load(std::memory_order_relaxed);
-        TaggedPtr new_head;
+        push_free_chain(node, node);
+    }
+
+    /**
+     * 미리 연결된 노드 체인 [first ... last]를 Free List에 push
+     *
+     * last->next만 CAS 재시도마다 갱신 → 체인 길이와 무관하게 CAS 한 번
+     *
+     * @param first 체인의 첫 노드
+     * @param last  체인의 마지막 노드
+     */
+    void push_free_chain(FreeNode* first, FreeNode* last) {
+        TaggedPtr<FreeNode> old_head = free_list_.load(std::memory_order_relaxed);
+        TaggedPtr<FreeNode> new_head;
         
         do {
-            node->next = old_head.ptr();
-            new_head = TaggedPtr{node, static_cast<std::uint16_t>(old_head.tag() + 1)};
+            last->next = old_head.ptr();
+            new_head = old_head.advanced(first);
         } while (!free_list_.compare_exchange_weak(
-            old_head,   // expected (64비트 전체가 일치해야 성공)
+            old_head,   // expected (포인터 + 태그 전체가 일치해야 성공)
             new_head,   // desired
             std::memory_order_release,
             std::memory_order_relaxed
@@ -575,4 +553,30 @@ public:
 template <typename T>
 using CacheAlignedPool = MemoryPool<T>;
 
+/**
+ * MemoryPool과 같은 인터페이스의 new/delete 할당자
+ *
+ * 노드 할당자를 받는 자료구조(ABASafeStack 등)에서 풀 대신 사용
+ * (비교 벤치마크, sanitizer로 use-after-free를 잡고 싶을 때)
+ */
+template <typename T>
+class HeapAllocator {
+public:
+    template <typename... Args>
+    T* construct(Args&&... args) {
+        return new T(std::forward<Args>(args)...);
+    }
+
+    void destroy(T* ptr) {
+        delete ptr;
+    }
+
+    template <typename Ptr>
+    void destroy_bulk(Ptr const* ptrs, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            delete static_cast<T*>(ptrs[i]);
+        }
+    }
+};
+
 } // namespace lockfree
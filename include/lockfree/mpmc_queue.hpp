@@ -5,6 +5,8 @@
 #include <array>
 #include <cstddef>
 
+#include "backoff.hpp"
+
 // Suppress MSVC warning C4324: structure was padded due to alignment specifier
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -13,7 +15,10 @@
 
 namespace lockfree {
 
-template<typename T, size_t Capacity>
+// Backoff: CAS 경합 시 재시도 전 물러나기 전략 (backoff.hpp)
+//          기본값 NoBackoff = 즉시 재시도
+//          큐는 블로킹하지 않으므로 should_block()은 사용하지 않음
+template<typename T, size_t Capacity, BackoffPolicy Backoff = NoBackoff>
 class MPMCQueue {
     static_assert(Capacity > 1, "Capacity must be greater than 1");
     static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
@@ -38,6 +43,7 @@ public:
     
     bool push(const T& value) {
         size_t pos = head_.load(std::memory_order_relaxed);
+        Backoff backoff;
         for (;;) {
             Slot& slot = buffer_[pos & (Capacity - 1)];
             size_t seq = slot.sequence.load(std::memory_order_acquire);
@@ -51,11 +57,14 @@ public:
                     slot.sequence.store(pos + 1, std::memory_order_release);
                     return true;
                 }
+                // CAS failed, pos is updated, retry after backing off
+                backoff.pause();
             } else if (diff < 0) {
                 // Queue is full
                 return false;
             } else {
                 pos = head_.load(std::memory_order_relaxed);
+                backoff.pause();
             }
         }
         return false;
@@ -63,6 +72,7 @@ public:
     
     bool push(T&& value) {
         size_t pos = head_.load(std::memory_order_relaxed);
+        Backoff backoff;
         for (;;) {
             Slot& slot = buffer_[pos & (Capacity - 1)];
             size_t seq = slot.sequence.load(std::memory_order_acquire);
@@ -76,11 +86,14 @@ public:
                     slot.sequence.store(pos + 1, std::memory_order_release);
                     return true;
                 }
+                // CAS failed, pos is updated, retry after backing off
+                backoff.pause();
             } else if (diff < 0) {
                 // Queue is full
                 return false;
             } else {
                 pos = head_.load(std::memory_order_relaxed);
+                backoff.pause();
             }
         }
         return false;
@@ -89,6 +102,7 @@ public:
     bool pop(T& value) {
         // Hint: Use tail_.compare_exchange_weak for consumer competition
         size_t pos = tail_.load(std::memory_order_relaxed);
+        Backoff backoff;
         for (;;) {
             Slot& slot = buffer_[pos & (Capacity - 1)];
             size_t seq = slot.sequence.load(std::memory_order_acquire);
@@ -101,11 +115,14 @@ public:
                     slot.sequence.store(pos + Capacity, std::memory_order_release);
                     return true;
                 }
+                // CAS failed, pos is updated, retry after backing off
+                backoff.pause();
             } else if (diff < 1) {
                 // Queue is empty
                 return false;
             } else {
                 pos = tail_.load(std::memory_order_relaxed);
+                backoff.pause();
             }
         }
         return false;
@@ -0,0 +1,219 @@
+/**
+ * Michael-Scott Queue - Unbounded Lock-Free MPMC Queue (Michael & Scott, 1996)
+ *
+ * SPSC/MPSC/MPMC 큐는 고정 크기 링 버퍼 → 가득 차면 push 실패
+ * 생산 속도가 들쭉날쭉한 작업(버스트)에는 크기 제한 없는 큐가 필요
+ *
+ * 연결 리스트 + 더미 노드:
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  head_                                     tail_             │
+ * │    │                                         │               │
+ * │    ▼                                         ▼               │
+ * │  [dummy] ──► [A] ──► [B] ──► [C] ──► nullptr                 │
+ * │                                                              │
+ * │  pop:  head_를 A로 옮기고 A의 값을 꺼냄 (A가 새 dummy)          │
+ * │  push: tail->next에 CAS로 연결 후 tail_을 옮김                  │
+ * │        (tail_이 뒤처져 있으면 누구든 앞으로 밀어줌 - helping)    │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * 메모리 회수:
+ *   pop한 스레드가 옛 dummy를 바로 delete하면
+ *   동시에 head->next를 읽던 스레드가 해제된 메모리를 읽음
+ *   → hazard pointer로 head/next를 보호하고, 옛 dummy는 retire
+ *   (태그로 ABA만 막는 방식과 달리 해제된 노드를 읽는 일 자체가 없음)
+ *
+ * 노드 할당 (ABASafeStack과 같은 정책):
+ *   기본값 MemoryPool → push/pop마다 전역 new/delete 없음
+ *   retire된 노드는 묶음으로 풀에 반환 (destroy_bulk)
+ *   MSQueue<T, EpochReclaimer>, MSQueue<T, HazardPointerReclaimer, HeapAllocator> 등
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+#include "hazard_pointer.hpp"
+#include "epoch.hpp"
+#include "memory_pool.hpp"
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lockfree {
+
+/**
+ * @tparam Reclaimer 노드 해제 정책 (HazardPointerReclaimer 또는 EpochReclaimer)
+ * @tparam Allocator 노드 할당자 (MemoryPool 또는 HeapAllocator)
+ */
+template <typename T,
+          typename Reclaimer = HazardPointerReclaimer,
+          template <typename> class Allocator = MemoryPool>
+class MSQueue {
+    struct Node : Reclaimer::node_base {
+        std::atomic<Node*> next{nullptr};
+        std::optional<T> value;  // dummy는 비어 있음
+    };
+
+    using domain_type = typename Reclaimer::domain_type;
+    using guard_type = typename Reclaimer::guard_type;
+
+public:
+    MSQueue() {
+        Node* dummy = allocator_.construct();
+        head_.store(dummy, std::memory_order_relaxed);
+        tail_.store(dummy, std::memory_order_relaxed);
+    }
+
+    ~MSQueue() {
+        // 사용 중인 스레드가 없음 → 남은 노드를 그대로 해제
+        Node* node = head_.load(std::memory_order_relaxed);
+        while (node != nullptr) {
+            Node* next = node->next.load(std::memory_order_relaxed);
+            allocator_.destroy(node);
+            node = next;
+        }
+        // 이후 domain_ 소멸자가 retire된 노드를 allocator_에 반환
+    }
+
+    // Non-copyable, non-movable
+    MSQueue(const MSQueue&) = delete;
+    MSQueue& operator=(const MSQueue&) = delete;
+    MSQueue(MSQueue&&) = delete;
+    MSQueue& operator=(MSQueue&&) = delete;
+
+    void push(const T& value) {
+        Node* node = allocator_.construct();
+        node->value.emplace(value);
+        enqueue(node);
+    }
+
+    void push(T&& value) {
+        Node* node = allocator_.construct();
+        node->value.emplace(std::move(value));
+        enqueue(node);
+    }
+
+    /**
+     * @return 꺼냈으면 true, 비어 있으면 false
+     */
+    bool pop(T& value) {
+        guard_type hp_head(domain_);
+        guard_type hp_next(domain_);
+
+        while (true) {
+            Node* head = hp_head.protect(head_);
+            Node* tail = tail_.load(std::memory_order_acquire);
+            Node* next = head->next.load(std::memory_order_acquire);
+
+            // next 보호: head가 아직 head_이면 next는 아직 retire되지 않음
+            // (노드는 head_가 그 노드를 지나간 뒤에만 retire됨)
+            hp_next.reset_protection(next);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (head != head_.load(std::memory_order_acquire)) {
+                continue;
+            }
+
+            if (next == nullptr) {
+                return false;  // 비어 있음 (dummy만 남음)
+            }
+
+            if (head == tail) {
+                // tail_이 뒤처짐 → 먼저 밀어주고 재시도
+                tail_.compare_exchange_weak(
+                    tail, next,
+                    std::memory_order_release,
+                    std::memory_order_relaxed);
+                continue;
+            }
+
+            if (head_.compare_exchange_weak(
+                    head, next,
+                    std::memory_order_acquire,
+                    std::memory_order_relaxed)) {
+                // next가 새 dummy, 값은 이긴 스레드만 꺼냄
+                // (next는 hp_next로 보호 중 → 이 사이 해제되지 않음)
+                value = std::move(*next->value);
+                next->value.reset();
+
+                hp_head.reset_protection();
+                hp_next.reset_protection();
+                domain_.retire(head);
+                return true;
+            }
+        }
+    }
+
+    /**
+     * 비어 있는지 (근사값)
+     */
+    bool empty() const {
+        guard_type hp(domain_);
+        Node* head = hp.protect(head_);
+        return head->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    void enqueue(Node* node) {
+        guard_type hp(domain_);
+
+        while (true) {
+            Node* tail = hp.protect(tail_);
+            Node* next = tail->next.load(std::memory_order_acquire);
+            if (tail != tail_.load(std::memory_order_acquire)) {
+                continue;
+            }
+
+            if (next != nullptr) {
+                // 다른 스레드의 push가 tail_을 아직 못 옮김 → 도와줌
+                tail_.compare_exchange_weak(
+                    tail, next,
+                    std::memory_order_release,
+                    std::memory_order_relaxed);
+                continue;
+            }
+
+            // release: node의 값이 연결과 함께 pop 쪽에 보임
+            Node* expected = nullptr;
+            if (tail->next.compare_exchange_weak(
+                    expected, node,
+                    std::memory_order_release,
+                    std::memory_order_relaxed)) {
+                // 실패해도 괜찮음 (다른 스레드가 이미 밀어줌)
+                tail_.compare_exchange_strong(
+                    tail, node,
+                    std::memory_order_release,
+                    std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    // 안전해진 노드 묶음을 할당자에 반환 (domain이 호출)
+    static void reclaim_nodes(typename Reclaimer::node_base* const* nodes,
+                              std::size_t count, void* context) {
+        static_cast<MSQueue*>(context)->allocator_.destroy_bulk(nodes, count);
+    }
+
+private:
+    // 노드 할당자 (domain_보다 먼저 생성/나중에 소멸)
+    Allocator<Node> allocator_;
+
+    // head_ / tail_은 각자 캐시라인 (소비자/생산자 분리)
+    alignas(64) std::atomic<Node*> head_{nullptr};
+    alignas(64) std::atomic<Node*> tail_{nullptr};
+
+    // const 메서드(empty)에서도 보호가 필요 → mutable
+    mutable domain_type domain_{&reclaim_nodes, this};
+};
+
+} // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,176 @@
+/**
+ * NUMA Topology - 현재 스레드가 어느 NUMA 노드에서 돌고 있는지
+ *
+ * 2-소켓 머신: 소켓마다 메모리 컨트롤러와 L3가 따로 있음
+ *   같은 소켓 안 캐시라인 전송:   ~40ns
+ *   소켓 간 (인터커넥트 경유):    ~100ns 이상
+ * → 락을 "같은 노드 안에서" 넘겨주면 훨씬 쌈 (CohortLock)
+ *
+ * 감지 방법 (Linux):
+ *   /sys/devices/system/node/online          → 노드 번호 목록 ("0-1")
+ *   /sys/devices/system/node/nodeN/cpulist   → 노드 N의 CPU 목록 ("0-15,32-47")
+ *   sched_getcpu()                           → 지금 도는 CPU (vDSO, 시스템 콜 없음)
+ *   → CPU 번호로 노드를 표에서 찾음
+ *
+ * 그 외 플랫폼이나 sysfs가 없는 환경(컨테이너, CI): 노드 1개로 동작
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>  // sched_getcpu()
+#endif
+
+namespace lockfree {
+
+namespace detail {
+
+/**
+ * sysfs 목록 형식 파싱: "0-3,8,10-11" → {0,1,2,3,8,10,11}
+ *
+ * 잘못된 토큰은 건너뜀
+ */
+inline std::vector<std::uint32_t> parse_cpu_list(std::string_view text) {
+    std::vector<std::uint32_t> result;
+
+    auto parse_number = [](std::string_view s, std::uint32_t& out) {
+        if (s.empty()) {
+            return false;
+        }
+        std::uint32_t value = 0;
+        for (char c : s) {
+            if (c < '0' || c > '9') {
+                return false;
+            }
+            value = value * 10 + static_cast<std::uint32_t>(c - '0');
+        }
+        out = value;
+        return true;
+    };
+
+    while (!text.empty()) {
+        std::size_t comma = text.find(',');
+        std::string_view token = text.substr(0, comma);
+        text = (comma == std::string_view::npos) ? std::string_view{} : text.substr(comma + 1);
+
+        // 앞뒤 공백/개행 제거
+        while (!token.empty() && (token.front() == ' ' || token.front() == '\n')) {
+            token.remove_prefix(1);
+        }
+        while (!token.empty() && (token.back() == ' ' || token.back() == '\n')) {
+            token.remove_suffix(1);
+        }
+
+        std::size_t dash = token.find('-');
+        std::uint32_t first = 0;
+        std::uint32_t last = 0;
+        if (dash == std::string_view::npos) {
+            if (!parse_number(token, first)) {
+                continue;
+            }
+            last = first;
+        } else if (!parse_number(token.substr(0, dash), first) ||
+                   !parse_number(token.substr(dash + 1), last) ||
+                   last < first) {
+            continue;
+        }
+
+        for (std::uint32_t cpu = first; cpu <= last; ++cpu) {
+            result.push_back(cpu);
+        }
+    }
+    return result;
+}
+
+} // namespace detail
+
+class NumaTopology {
+public:
+    /**
+     * 프로세스 전체에서 한 번만 감지 (첫 호출 시)
+     */
+    static const NumaTopology& instance() {
+        static const NumaTopology topology = detect();
+        return topology;
+    }
+
+    /**
+     * 노드 수 (항상 1 이상)
+     *
+     * sysfs의 노드 번호가 띄엄띄엄이어도 (0, 2) 여기서는 0..node_count()-1로 압축
+     */
+    std::uint32_t node_count() const {
+        return node_count_;
+    }
+
+    /**
+     * 호출 스레드가 지금 도는 노드 (0..node_count()-1)
+     *
+     * 스레드는 언제든 다른 CPU로 옮겨질 수 있으므로 힌트일 뿐
+     * (CohortLock은 lock() 시점의 노드를 기억해서 unlock에 사용)
+     */
+    std::uint32_t current_node() const {
+        if (node_count_ == 1) {
+            return 0;
+        }
+#if defined(__linux__)
+        int cpu = sched_getcpu();
+        if (cpu >= 0 && static_cast<std::size_t>(cpu) < cpu_to_node_.size()) {
+            return cpu_to_node_[static_cast<std::size_t>(cpu)];
+        }
+#endif
+        return 0;
+    }
+
+private:
+    NumaTopology() = default;
+
+    static NumaTopology detect() {
+        NumaTopology topology;
+#if defined(__linux__)
+        const std::string base = "/sys/devices/system/node/";
+
+        std::vector<std::uint32_t> nodes = detail::parse_cpu_list(read_file(base + "online"));
+        std::uint32_t dense = 0;
+        for (std::uint32_t node : nodes) {
+            std::vector<std::uint32_t> cpus = detail::parse_cpu_list(
+                read_file(base + "node" + std::to_string(node) + "/cpulist"));
+            if (cpus.empty()) {
+                continue;  // CPU 없는 노드 (메모리 전용)
+            }
+            for (std::uint32_t cpu : cpus) {
+                if (cpu >= topology.cpu_to_node_.size()) {
+                    topology.cpu_to_node_.resize(cpu + 1, 0);
+                }
+                topology.cpu_to_node_[cpu] = dense;
+            }
+            ++dense;
+        }
+        if (dense > 0) {
+            topology.node_count_ = dense;
+        }
+#endif
+        return topology;
+    }
+
+    static std::string read_file(const std::string& path) {
+        std::ifstream in(path);
+        std::string line;
+        std::getline(in, line);
+        return line;
+    }
+
+private:
+    std::uint32_t node_count_ = 1;
+
+    // CPU 번호 → 압축된 노드 번호
+    std::vector<std::uint32_t> cpu_to_node_;
+};
+
+} // namespace lockfree
@@ -0,0 +1,588 @@
+/**
+ * Parallel Algorithms on JobSystem
+ *
+ * 반복마다 schedule하면:
+ *   parallel_for(0, 1'000'000)  →  Job 100만 개 → 큐가 넘치고 Job 비용이 일보다 큼
+ *
+ * 재귀 이진 분할 + 게으른(수요 기반) 분할 - TBB auto_partitioner,
+ * Lazy Binary Splitting (Tzannes et al., PPoPP 2010)과 같은 아이디어:
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  [begin ─────────────────────────────────────────── end)     │
+ * │                                                              │
+ * │  while (남은 범위 > grain):                                   │
+ * │      if (js.has_demand())    ← 가져갈 Job이 안 보임 = 놀 워커   │
+ * │          뒤쪽 절반을 Job으로 떼어 줌, 앞쪽 절반으로 계속         │
+ * │      else                                                    │
+ * │          grain개만 직접 실행하고 다시 확인                      │
+ * │  나머지 실행                                                  │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ *   - 모두 바쁘면 분할하지 않음 → Job 수 ≈ 워커 수 × log(범위), 반복 수와 무관
+ *   - 누가 일을 다 끝내면 (큐가 비면) 바로 절반을 떼어 줌 → 부하 균형
+ *   - WorkStealing 모드에서는 떼어 준 절반이 자기 deque로 → 도둑이 큰 쪽을 가져감
+ *
+ * 호출 스레드도 범위의 일부를 실행하고, 끝나면 wait_for_counter로
+ * 다른 Job을 도우며 기다림 → 워커 안에서 중첩 호출해도 교착 없음
+ *
+ * parallel_reduce / parallel_inclusive_scan - 고정 분할 + 부모/자식 Job:
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  [ P0 ][ P1 ][ P2 ] ... [ Pk ]   k ≈ (워커 수 + 1) × 4         │
+ * │                                                              │
+ * │  루트 Job ─┬─ 자식 P1 ─► partials[1]   (캐시라인 하나씩)         │
+ * │           ├─ 자식 P2 ─► partials[2]                          │
+ * │           └─ 자신 P0 ─► partials[0]                          │
+ * │  루트 counter = 0  ⇔  루트 함수 + 모든 자식 완료              │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ *   reduce: 조각별 부분 결과 → 호출자가 왼쪽부터 combine (결합법칙만 필요)
+ *   scan:   1패스 조각 합 → 조각 시작값(누적) 계산 → 2패스 조각별 스캔
+ *           (입력을 두 번 읽음, 쓰기는 한 번)
+ *
+ * parallel_sort - 같은 조각 나누기 위에서 두 경로:
+ *   정수 키 + 오름차순: LSD 기수 정렬 (8비트 자릿수, 조각별 히스토그램)
+ *   그 외:              샘플 정렬 (표본으로 경계값 → 버킷으로 분산 → 버킷별 std::sort)
+ *   둘 다 조각 수준에서만 병렬 → 순차 구간은 조각 수에 비례 (입력 크기와 무관)
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "job_system.hpp"
+
+namespace lockfree {
+
+namespace detail {
+
+/**
+ * parallel_for 한 번의 공유 상태 (호출자 스택에 있음, 모든 Job이 끝날 때까지 유효)
+ *
+ * Job은 이 상태의 포인터와 범위만 캡처 → InlineFunction 용량(48바이트) 안
+ */
+template <typename Index, typename F>
+struct ForState {
+    ForState(JobSystem& system, Index grain_size, const F& fn)
+        : js(system), grain(grain_size), body(fn) {}
+
+    JobSystem& js;
+    const Index grain;
+    const F& body;
+    Counter counter{0};
+    std::atomic<std::size_t> jobs_spawned{0};
+};
+
+template <typename Index, typename F>
+void run_range(ForState<Index, F>& state, Index begin, Index end) {
+    while (end - begin > state.grain) {
+        if (state.js.has_demand()) {
+            // 놀고 있는 워커가 있을 수 있음 → 뒤쪽 절반을 넘김
+            Index mid = begin + (end - begin) / 2;
+            ForState<Index, F>* shared = &state;
+            bool scheduled = state.js.schedule([shared, mid, end]() {
+                run_range(*shared, mid, end);
+            }, &state.counter);
+
+            if (scheduled) {
+                state.jobs_spawned.fetch_add(1, std::memory_order_relaxed);
+                end = mid;
+                continue;
+            }
+            // 큐가 거부함 (OverflowPolicy::Reject) → 그냥 직접 실행
+        }
+
+        // 모두 바쁨 → grain만큼만 실행하고 다시 수요 확인
+        Index chunk_end = begin + state.grain;
+        for (Index i = begin; i < chunk_end; ++i) {
+            std::invoke(state.body, i);
+        }
+        begin = chunk_end;
+    }
+
+    for (Index i = begin; i < end; ++i) {
+        std::invoke(state.body, i);
+    }
+}
+
+/**
+ * 워커 하나당 조각 수 (조각 크기가 고르지 않아도 일찍 끝난 워커가 남은 조각을 가져감)
+ */
+inline constexpr std::size_t PARTITIONS_PER_WORKER = 4;
+
+/**
+ * 조각별 부분 결과 (이웃 조각의 결과와 캐시라인을 나누지 않음)
+ */
+template <typename T>
+struct alignas(64) Partial {
+    T value;
+};
+
+/**
+ * n개를 grain 이상씩 나눌 조각 수 (호출 스레드도 워커로 셈)
+ */
+inline std::size_t partition_count(const JobSystem& js, std::size_t n, std::size_t grain) {
+    if (grain < 1) {
+        grain = 1;
+    }
+    std::size_t by_grain = (n + grain - 1) / grain;
+    std::size_t by_workers = (js.worker_count() + 1) * PARTITIONS_PER_WORKER;
+    std::size_t count = by_grain < by_workers ? by_grain : by_workers;
+    return count < 1 ? 1 : count;
+}
+
+/**
+ * n개를 count 조각으로 나눈 c번째 조각의 시작 오프셋 (크기 차이 최대 1)
+ */
+inline std::size_t partition_begin(std::size_t n, std::size_t count, std::size_t c) {
+    return n / count * c + (c < n % count ? c : n % count);
+}
+
+/**
+ * fn(0) ... fn(count - 1)을 병렬 실행하고 모두 끝날 때까지 기다림
+ *
+ * 루트 Job 하나가 나머지 조각을 자식으로 만들고 0번 조각은 직접 실행
+ * → 루트의 counter가 0 = 모든 조각 완료 (Job::parent 메커니즘)
+ * 예약이 거부되면 (OverflowPolicy::Reject) 그 조각은 그 자리에서 실행
+ */
+template <typename F>
+void run_partitions(JobSystem& js, std::size_t count, const F& fn) {
+    Job* root = count > 1 ? js.allocate_job() : nullptr;
+    if (root == nullptr) {
+        for (std::size_t c = 0; c < count; ++c) {
+            fn(c);
+        }
+        return;
+    }
+
+    Counter done(0);
+    const F* body = &fn;
+    root->counter = &done;
+    root->function.emplace([&js, root, body, count]() {
+        for (std::size_t c = 1; c < count; ++c) {
+            if (!js.schedule_child(root, [body, c]() { (*body)(c); })) {
+                (*body)(c);
+            }
+        }
+        (*body)(0);
+    });
+
+    done.increment();
+    if (!js.schedule(root)) {
+        done.decrement();
+        js.deallocate_job(root);
+        for (std::size_t c = 0; c < count; ++c) {
+            fn(c);
+        }
+        return;
+    }
+    js.wait_for_counter(&done);
+}
+
+// ========================================
+// 정렬 내부
+// ========================================
+
+/**
+ * 이보다 작은 입력(또는 조각)은 std::sort 한 번이 더 빠름
+ */
+inline constexpr std::size_t SORT_SEQUENTIAL_CUTOFF = 1 << 14;
+
+/**
+ * 샘플 정렬: 버킷 하나당 표본 수 (많을수록 버킷 크기가 고름)
+ */
+inline constexpr std::size_t SAMPLE_OVERSAMPLING = 32;
+
+/**
+ * 기수 정렬 자릿수 (8비트 → 히스토그램 256칸 = 2KB, L1에 들어감)
+ */
+inline constexpr unsigned RADIX_BITS = 8;
+inline constexpr std::size_t RADIX_BUCKETS = std::size_t{1} << RADIX_BITS;
+
+template <typename T>
+concept RadixSortable = std::integral<T> && !std::same_as<T, bool>;
+
+/**
+ * 부호 있는 정수 → 같은 순서의 부호 없는 키 (부호 비트 뒤집기)
+ */
+template <RadixSortable T>
+constexpr std::make_unsigned_t<T> radix_key(T value) {
+    using U = std::make_unsigned_t<T>;
+    if constexpr (std::is_signed_v<T>) {
+        return static_cast<U>(static_cast<U>(value) ^ (U{1} << (sizeof(T) * CHAR_BIT - 1)));
+    } else {
+        return value;
+    }
+}
+
+/**
+ * 기수 정렬 한 자릿수 (src → dst, 안정)
+ *
+ * 1. 조각별 히스토그램 (스택의 지역 배열에 세고 한 번에 복사 → false sharing 없음)
+ * 2. (자릿수, 조각) 순서로 누적 → 조각 p의 자릿수 d가 쓸 시작 위치
+ * 3. 조각별로 자기 위치에 흩뿌림 (같은 자릿수 안에서 조각 순서 = 원래 순서)
+ *
+ * @return false = 모든 원소의 이 자릿수가 같음 (옮기지 않았음, src 그대로)
+ */
+template <typename Src, typename Dst>
+bool radix_pass(JobSystem& js, std::size_t n, std::size_t parts, unsigned shift, Src src, Dst dst) {
+    auto digit = [shift](const auto& value) {
+        return static_cast<std::size_t>((radix_key(value) >> shift) & (RADIX_BUCKETS - 1));
+    };
+
+    std::vector<std::size_t> offsets(parts * RADIX_BUCKETS);
+    run_partitions(js, parts, [&](std::size_t p) {
+        std::array<std::size_t, RADIX_BUCKETS> local{};
+        const std::size_t hi = partition_begin(n, parts, p + 1);
+        for (std::size_t i = partition_begin(n, parts, p); i < hi; ++i) {
+            ++local[digit(src[static_cast<std::iter_difference_t<Src>>(i)])];
+        }
+        std::copy(local.begin(), local.end(), offsets.begin() + static_cast<std::ptrdiff_t>(p * RADIX_BUCKETS));
+    });
+
+    std::size_t running = 0;
+    for (std::size_t d = 0; d < RADIX_BUCKETS; ++d) {
+        const std::size_t digit_begin = running;
+        for (std::size_t p = 0; p < parts; ++p) {
+            std::size_t count = offsets[p * RADIX_BUCKETS + d];
+            offsets[p * RADIX_BUCKETS + d] = running;
+            running += count;
+        }
+        if (running - digit_begin == n) {
+            return false;  // 한 자릿수에 전부 → 이 패스는 순서를 바꾸지 않음
+        }
+    }
+
+    run_partitions(js, parts, [&](std::size_t p) {
+        std::array<std::size_t, RADIX_BUCKETS> pos;
+        std::copy_n(offsets.begin() + static_cast<std::ptrdiff_t>(p * RADIX_BUCKETS), RADIX_BUCKETS, pos.begin());
+        const std::size_t hi = partition_begin(n, parts, p + 1);
+        for (std::size_t i = partition_begin(n, parts, p); i < hi; ++i) {
+            const auto& value = src[static_cast<std::iter_difference_t<Src>>(i)];
+            dst[static_cast<std::iter_difference_t<Dst>>(pos[digit(value)]++)] = value;
+        }
+    });
+    return true;
+}
+
+/**
+ * 샘플 정렬
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  1. 표본 (버킷 수 × 32개) 정렬 → 경계값 (버킷 수 - 1)개        │
+ * │  2. 조각별로 원소마다 버킷 번호 (경계값 이진 탐색) → 개수 세기  │
+ * │  3. (버킷, 조각) 순서로 누적 → 조각별로 임시 배열에 흩뿌림      │
+ * │  4. 버킷별 std::sort 후 원래 범위로 이동 (버킷끼리 독립)        │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * 같은 키가 아주 많으면 그 키의 버킷이 커짐 → 해당 버킷의 std::sort가 길어짐
+ */
+template <std::random_access_iterator It, typename Compare>
+    requires std::default_initializable<std::iter_value_t<It>> && std::copyable<std::iter_value_t<It>>
+void sample_sort(JobSystem& js, It first, It last, Compare comp) {
+    using T = std::iter_value_t<It>;
+    using Diff = std::iter_difference_t<It>;
+
+    const auto n = static_cast<std::size_t>(last - first);
+    const std::size_t parts = partition_count(js, n, SORT_SEQUENTIAL_CUTOFF);
+    if (parts < 2) {
+        std::sort(first, last, comp);
+        return;
+    }
+    const std::size_t buckets = parts;
+
+    // 1. 경계값 (표본 위치는 입력 크기로 시드한 고정 난수 → 실행마다 같은 결과)
+    std::vector<T> sample;
+    sample.reserve(buckets * SAMPLE_OVERSAMPLING);
+    std::mt19937_64 rng(n);
+    for (std::size_t k = 0; k < buckets * SAMPLE_OVERSAMPLING; ++k) {
+        sample.push_back(first[static_cast<Diff>(rng() % n)]);
+    }
+    std::sort(sample.begin(), sample.end(), comp);
+
+    std::vector<T> splitters;
+    splitters.reserve(buckets - 1);
+    for (std::size_t b = 1; b < buckets; ++b) {
+        splitters.push_back(sample[b * SAMPLE_OVERSAMPLING]);
+    }
+    auto bucket_of = [&](const T& value) {
+        return static_cast<std::size_t>(
+            std::upper_bound(splitters.begin(), splitters.end(), value, comp) - splitters.begin());
+    };
+
+    // 2. 조각별 버킷 개수
+    std::vector<std::size_t> offsets(parts * buckets);
+    run_partitions(js, parts, [&](std::size_t p) {
+        std::vector<std::size_t> local(buckets, 0);
+        const std::size_t hi = partition_begin(n, parts, p + 1);
+        for (std::size_t i = partition_begin(n, parts, p); i < hi; ++i) {
+            ++local[bucket_of(first[static_cast<Diff>(i)])];
+        }
+        std::copy(local.begin(), local.end(), offsets.begin() + static_cast<std::ptrdiff_t>(p * buckets));
+    });
+
+    // 3. 누적 + 흩뿌리기
+    std::vector<std::size_t> bucket_begin(buckets + 1);
+    std::size_t running = 0;
+    for (std::size_t b = 0; b < buckets; ++b) {
+        bucket_begin[b] = running;
+        for (std::size_t p = 0; p < parts; ++p) {
+            std::size_t count = offsets[p * buckets + b];
+            offsets[p * buckets + b] = running;
+            running += count;
+        }
+    }
+    bucket_begin[buckets] = running;
+
+    std::vector<T> buffer(n);
+    run_partitions(js, parts, [&](std::size_t p) {
+        std::vector<std::size_t> pos(offsets.begin() + static_cast<std::ptrdiff_t>(p * buckets),
+                                     offsets.begin() + static_cast<std::ptrdiff_t>((p + 1) * buckets));
+        const std::size_t hi = partition_begin(n, parts, p + 1);
+        for (std::size_t i = partition_begin(n, parts, p); i < hi; ++i) {
+            auto&& value = first[static_cast<Diff>(i)];
+            buffer[pos[bucket_of(value)]++] = std::move(value);
+        }
+    });
+
+    // 4. 버킷별 정렬 후 제자리로
+    run_partitions(js, buckets, [&](std::size_t b) {
+        auto lo = buffer.begin() + static_cast<std::ptrdiff_t>(bucket_begin[b]);
+        auto hi = buffer.begin() + static_cast<std::ptrdiff_t>(bucket_begin[b + 1]);
+        std::sort(lo, hi, comp);
+        std::move(lo, hi, first + static_cast<Diff>(bucket_begin[b]));
+    });
+}
+
+} // namespace detail
+
+/**
+ * [begin, end)의 각 i에 대해 f(i)를 JobSystem 워커들에서 병렬 실행
+ *
+ * @param js    실행할 JobSystem
+ * @param grain 한 번에 직접 실행하는 최소 반복 수 (이보다 작게는 나누지 않음)
+ * @param f     반복 본문 (여러 스레드에서 동시에 호출됨)
+ *              → const로 호출 가능해야 함 (mutable 람다처럼 호출할 때마다
+ *                자기 상태를 바꾸는 본문은 데이터 경쟁이라 컴파일 에러)
+ * @return 만든 Job 수 (진단용: 반복 수가 아니라 워커 수에 비례해야 함)
+ *
+ * 예:
+ *   parallel_for(js, std::size_t{0}, data.size(), std::size_t{1024},
+ *                [&](std::size_t i) { data[i] *= 2; });
+ */
+template <std::integral Index, typename F>
+    requires std::invocable<const std::remove_reference_t<F>&, Index>
+std::size_t parallel_for(JobSystem& js, Index begin, Index end, Index grain, F&& f) {
+    if (begin >= end) {
+        return 0;
+    }
+    if (grain < 1) {
+        grain = 1;
+    }
+
+    detail::ForState<Index, std::remove_reference_t<F>> state(js, grain, f);
+    detail::run_range(state, begin, end);
+
+    // 떼어 준 Job들이 끝날 때까지 (기다리는 동안 다른 Job을 실행)
+    js.wait_for_counter(&state.counter);
+    return state.jobs_spawned.load(std::memory_order_relaxed);
+}
+
+/**
+ * [begin, end)를 병렬로 접어서 하나의 값으로
+ *
+ * @param grain      조각 하나의 최소 반복 수
+ * @param identity   각 조각의 초기값 (reduce_op/combine_op의 항등원)
+ * @param reduce_op  T(T acc, Index i)  - 조각 안에서 원소 하나를 누적
+ * @param combine_op T(T left, T right) - 이웃한 두 조각의 결과를 합침
+ * @return 결과 (빈 범위면 identity)
+ *
+ * combine_op는 왼쪽 조각부터 순서대로 적용 → 결합법칙만 필요 (교환법칙 불필요)
+ * 누적값은 std::move로 넘김 → 히스토그램 같은 큰 T도 복사 없이 누적
+ *
+ * 예:
+ *   auto sum = parallel_reduce(js, std::size_t{0}, v.size(), std::size_t{4096}, 0LL,
+ *       [&](long long acc, std::size_t i) { return acc + v[i]; },
+ *       std::plus<>{});
+ */
+template <std::integral Index, typename T, typename ReduceOp, typename CombineOp>
+T parallel_reduce(JobSystem& js, Index begin, Index end, Index grain, T identity,
+                  ReduceOp reduce_op, CombineOp combine_op) {
+    if (begin >= end) {
+        return identity;
+    }
+
+    const auto n = static_cast<std::size_t>(end - begin);
+    const std::size_t count = detail::partition_count(js, n, static_cast<std::size_t>(grain));
+
+    std::vector<detail::Partial<T>> partials(count, detail::Partial<T>{identity});
+    detail::run_partitions(js, count, [&](std::size_t c) {
+        const Index lo = begin + static_cast<Index>(detail::partition_begin(n, count, c));
+        const Index hi = begin + static_cast<Index>(detail::partition_begin(n, count, c + 1));
+
+        // 조각 안에서는 지역 변수에 누적 (공유 메모리에는 마지막에 한 번만 씀)
+        T acc = identity;
+        for (Index i = lo; i < hi; ++i) {
+            acc = std::invoke(reduce_op, std::move(acc), i);
+        }
+        partials[c].value = std::move(acc);
+    });
+
+    T result = std::move(partials[0].value);
+    for (std::size_t c = 1; c < count; ++c) {
+        result = std::invoke(combine_op, std::move(result), std::move(partials[c].value));
+    }
+    return result;
+}
+
+/**
+ * 병렬 포함 스캔 (std::inclusive_scan과 같은 결과)
+ *
+ * @param op    결합법칙을 만족하는 이항 연산 (교환법칙 불필요)
+ * @param grain 조각 하나의 최소 원소 수
+ * @return 출력 끝 (d_first + (last - first))
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  1패스: 조각별 합        s0      s1      s2     (마지막 조각 제외) │
+ * │  호출자: 시작값          -       s0      s0+s1                 │
+ * │  2패스: 조각별 스캔      [scan]  [s0+scan] [s0+s1+scan]         │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * 제자리 스캔 (d_first == first) 가능: 2패스에서 각 원소를 읽은 뒤에 씀
+ */
+template <std::random_access_iterator InputIt, std::random_access_iterator OutputIt,
+          typename BinaryOp = std::plus<>>
+OutputIt parallel_inclusive_scan(JobSystem& js, InputIt first, InputIt last, OutputIt d_first,
+                                 BinaryOp op = {}, std::size_t grain = 16384) {
+    using T = std::iter_value_t<InputIt>;
+
+    if (first == last) {
+        return d_first;
+    }
+
+    const auto n = static_cast<std::size_t>(last - first);
+    const std::size_t count = detail::partition_count(js, n, grain);
+    if (count == 1) {
+        return std::inclusive_scan(first, last, d_first, op);
+    }
+
+    auto bounds = [n, count](std::size_t c) {
+        return static_cast<std::iter_difference_t<InputIt>>(detail::partition_begin(n, count, c));
+    };
+
+    // 1패스: 조각 합 (마지막 조각의 합은 어디에도 쓰이지 않음)
+    std::vector<detail::Partial<T>> carries;
+    carries.reserve(count);
+    for (std::size_t c = 0; c < count; ++c) {
+        carries.push_back(detail::Partial<T>{first[bounds(c)]});
+    }
+    detail::run_partitions(js, count - 1, [&](std::size_t c) {
+        T acc = std::move(carries[c].value);
+        for (auto i = bounds(c) + 1; i < bounds(c + 1); ++i) {
+            acc = std::invoke(op, std::move(acc), first[i]);
+        }
+        carries[c].value = std::move(acc);
+    });
+
+    // 조각 c의 시작값 = 앞 조각들의 합 (조각 수만큼이라 순차로 충분)
+    for (std::size_t c = 1; c + 1 < count; ++c) {
+        carries[c].value = std::invoke(op, carries[c - 1].value, std::move(carries[c].value));
+    }
+
+    // 2패스: 조각별 스캔 (0번은 시작값 없음, c번은 carries[c - 1]에서 시작)
+    detail::run_partitions(js, count, [&](std::size_t c) {
+        auto i = bounds(c);
+        const auto hi = bounds(c + 1);
+        T acc = c == 0 ? T(first[i]) : std::invoke(op, carries[c - 1].value, first[i]);
+        d_first[i] = acc;
+        for (++i; i < hi; ++i) {
+            acc = std::invoke(op, std::move(acc), first[i]);
+            d_first[i] = acc;
+        }
+    });
+
+    return d_first + static_cast<std::iter_difference_t<OutputIt>>(n);
+}
+
+/**
+ * 병렬 LSD 기수 정렬 (정수, 오름차순)
+ *
+ * 8비트 자릿수마다 한 패스 (int32 → 4패스), 패스마다 입력을 두 번 읽고 한 번 씀
+ * 모든 원소의 자릿수가 같은 패스는 건너뜀 → 값 범위가 좁으면 패스가 줄어듦
+ * 임시 배열 n개 사용
+ */
+template <std::random_access_iterator It>
+    requires detail::RadixSortable<std::iter_value_t<It>>
+void parallel_radix_sort(JobSystem& js, It first, It last) {
+    using T = std::iter_value_t<It>;
+
+    const auto n = static_cast<std::size_t>(last - first);
+    const std::size_t parts = detail::partition_count(js, n, detail::SORT_SEQUENTIAL_CUTOFF);
+    if (parts < 2) {
+        std::sort(first, last);
+        return;
+    }
+
+    std::vector<T> buffer(n);
+    bool in_buffer = false;
+    for (unsigned shift = 0; shift < sizeof(T) * CHAR_BIT; shift += detail::RADIX_BITS) {
+        bool moved = in_buffer
+            ? detail::radix_pass(js, n, parts, shift, buffer.begin(), first)
+            : detail::radix_pass(js, n, parts, shift, first, buffer.begin());
+        if (moved) {
+            in_buffer = !in_buffer;
+        }
+    }
+
+    if (in_buffer) {
+        detail::run_partitions(js, parts, [&](std::size_t p) {
+            auto lo = static_cast<std::ptrdiff_t>(detail::partition_begin(n, parts, p));
+            auto hi = static_cast<std::ptrdiff_t>(detail::partition_begin(n, parts, p + 1));
+            std::copy(buffer.begin() + lo, buffer.begin() + hi, first + lo);
+        });
+    }
+}
+
+/**
+ * 병렬 정렬 (std::sort와 같은 결과, 안정 정렬 아님)
+ *
+ * @param comp 비교 함수 (기본 오름차순)
+ *
+ * 경로 선택 (컴파일 타임):
+ *   정수 + std::less        → parallel_radix_sort
+ *   기본 생성 + 복사 가능한 T → 샘플 정렬 (임시 배열 n개, 표본/경계값은 복사본)
+ *   그 외 (move-only 등)     → std::sort
+ *     (경계값을 복사해 둬야 흩뿌리기 중 원소를 옮겨도 비교 대상이 남음)
+ *
+ * 예:
+ *   parallel_sort(js, records.begin(), records.end(),
+ *                 [](const Record& a, const Record& b) { return a.key < b.key; });
+ */
+template <std::random_access_iterator It, typename Compare = std::less<>>
+void parallel_sort(JobSystem& js, It first, It last, Compare comp = {}) {
+    using T = std::iter_value_t<It>;
+
+    if constexpr (detail::RadixSortable<T> &&
+                  (std::same_as<Compare, std::less<>> || std::same_as<Compare, std::less<T>>)) {
+        parallel_radix_sort(js, first, last);
+    } else if constexpr (std::default_initializable<T> && std::copyable<T>) {
+        detail::sample_sort(js, first, last, comp);
+    } else {
+        std::sort(first, last, comp);
+    }
+}
+
+} // namespace lockfree
@@ -0,0 +1,390 @@
+/**
+ * Userspace RCU (Quiescent-State-Based Reclamation, QSBR)
+ *
+ * 설정 리로드처럼 "드물게 통째로 교체, 아주 자주 읽음"인 데이터용
+ *
+ * SeqLock/SharedSpinLock: reader도 매번 공유 카운터를 읽고/씀
+ * Hazard pointer/EBR:     reader가 읽을 때마다 또는 구역마다 게시 + fence
+ * QSBR:                   reader는 acquire load 하나뿐 (게시 없음)
+ *                         대신 가끔 "지금은 아무것도 안 잡고 있음"을 알림
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  writer:  old = ptr.exchange(new)                            │
+ * │           gp_ = g+1  (grace period 시작)                       │
+ * │                                                              │
+ * │  reader 0: ─ read ─ read ─ Q(g+1) ─ read ─                    │
+ * │  reader 1: ─ read ─────── Q(g+1) ─                            │
+ * │  reader 2: ─ offline ───────────────  (기다리지 않음)           │
+ * │                                 ▲                            │
+ * │           모든 online reader가 g+1 이상 → old 해제 가능          │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * Q = quiescent_state(): 이전에 읽은 포인터를 더 이상 쓰지 않는 지점
+ *     (요청 처리 루프의 끝 등) 에서 호출 → 자기 카운터 = 현재 gp_
+ *
+ * 해제 방식:
+ *   synchronize(): grace period가 끝날 때까지 호출자가 대기
+ *   call_rcu(cb):  백그라운드 스레드가 모아서 grace period 한 번에 처리
+ *                  (그 사이 쌓인 콜백 전부가 같은 grace period를 공유)
+ *
+ * 주의:
+ *   - online reader가 quiescent_state()를 부르지 않으면 synchronize가 끝나지 않음
+ *   - online reader 자신이 synchronize를 부르면 교착 → 먼저 offline()
+ *
+ * 사용 방법:
+ *   RcuPtr<RoutingTable> table(std::make_unique<RoutingTable>(...));
+ *
+ *   // reader 스레드
+ *   RcuReader reader;                  // 스레드 등록 (online)
+ *   while (running) {
+ *       const RoutingTable* t = table.read();
+ *       ... t 사용 ...
+ *       reader.quiescent_state();      // 여기서 t는 더 이상 안 씀
+ *   }
+ *
+ *   // writer
+ *   table.update(std::make_unique<RoutingTable>(...));  // 옛 테이블은 나중에 delete
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "reclamation.hpp"
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lockfree {
+
+class RcuReader;
+
+class RcuDomain {
+public:
+    RcuDomain() = default;
+
+    /**
+     * 남은 call_rcu 콜백을 모두 실행하고 백그라운드 스레드 종료
+     * (등록된 reader가 없어야 함)
+     */
+    ~RcuDomain() {
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            stop_ = true;
+        }
+        queue_cv_.notify_one();
+        if (worker_.joinable()) {
+            worker_.join();
+        }
+    }
+
+    // Non-copyable, non-movable
+    RcuDomain(const RcuDomain&) = delete;
+    RcuDomain& operator=(const RcuDomain&) = delete;
+    RcuDomain(RcuDomain&&) = delete;
+    RcuDomain& operator=(RcuDomain&&) = delete;
+
+    /**
+     * 프로세스 전역 도메인 (RcuPtr/RcuReader 기본값)
+     *
+     * 일부러 소멸시키지 않음 → 정적 소멸 순서와 무관하게 항상 유효
+     */
+    static RcuDomain& global() {
+        static RcuDomain* domain = new RcuDomain();
+        return *domain;
+    }
+
+    /**
+     * 호출 시점 이전에 읽힌 포인터를 모든 reader가 놓을 때까지 대기
+     *
+     * 호출자가 이 도메인의 online reader이면 안 됨 (자기 자신을 기다림)
+     */
+    void synchronize() {
+        // grace period는 하나씩 (동시에 부른 writer는 앞 것이 끝나길 기다림)
+        std::lock_guard<std::mutex> lock(sync_mutex_);
+
+        // 호출자의 포인터 교체 → gp_ 증가 → reader 카운터 읽기 순서 보장
+        std::uint64_t target = gp_.fetch_add(1, std::memory_order_seq_cst) + 1;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        for (RcuRecord* rec = records_.head(); rec != nullptr; rec = rec->next) {
+            while (true) {
+                std::uint64_t ctr = rec->ctr.load(std::memory_order_acquire);
+                if (ctr == OFFLINE || ctr >= target) {
+                    break;
+                }
+                // reader가 quiescent_state를 부를 때까지 (CPU 양보)
+                std::this_thread::yield();
+            }
+        }
+
+        grace_periods_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * grace period 뒤에 백그라운드 스레드에서 callback 실행
+     *
+     * 기다리지 않고 바로 반환 (콜백은 묶음으로 처리됨)
+     */
+    void call_rcu(std::function<void()> callback) {
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            if (!worker_.joinable()) {
+                worker_ = std::thread([this]() { worker_loop(); });
+            }
+            pending_.push_back(std::move(callback));
+            ++queued_;
+        }
+        queue_cv_.notify_one();
+    }
+
+    /**
+     * 지금까지 call_rcu로 넣은 콜백이 모두 실행될 때까지 대기
+     */
+    void barrier() {
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+        std::uint64_t target = queued_;
+        done_cv_.wait(lock, [&]() { return completed_ >= target; });
+    }
+
+    /**
+     * 지금까지 끝난 grace period 수 (통계)
+     */
+    std::uint64_t grace_period_count() const {
+        return grace_periods_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * 등록된 적 있는 reader record 수
+     */
+    std::size_t reader_count() const {
+        return records_.size();
+    }
+
+private:
+    friend class RcuReader;
+
+    // 카운터 0 = offline (grace period는 1부터 시작)
+    static constexpr std::uint64_t OFFLINE = 0;
+
+    /**
+     * reader record: 스레드 하나의 quiescent-state 카운터
+     *
+     * reader만 쓰고 synchronize만 읽음 → 각자 캐시라인
+     */
+    struct alignas(64) RcuRecord {
+        std::atomic<std::uint64_t> ctr{OFFLINE};
+        std::atomic<bool> active{false};
+        RcuRecord* next = nullptr;  // push 후 불변
+    };
+
+    void quiescent_state(RcuRecord* rec) {
+        // release: 이전 읽기가 끝난 뒤에 카운터가 보임
+        // acquire(gp_): 이후 읽기는 gp_를 올린 writer의 교체를 봄
+        rec->ctr.store(gp_.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    void online(RcuRecord* rec) {
+        rec->ctr.store(gp_.load(std::memory_order_acquire), std::memory_order_relaxed);
+        // online 게시가 이후 포인터 읽기보다 먼저 보이도록 (synchronize의 fence와 짝)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    static void offline(RcuRecord* rec) {
+        rec->ctr.store(OFFLINE, std::memory_order_release);
+    }
+
+    /**
+     * call_rcu 백그라운드 스레드
+     *
+     * 쌓인 콜백을 통째로 가져와 grace period 한 번 후 모두 실행
+     * → 콜백 수와 무관하게 묶음마다 synchronize 한 번
+     */
+    void worker_loop() {
+        std::vector<std::function<void()>> batch;
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+
+        while (true) {
+            queue_cv_.wait(lock, [&]() { return stop_ || !pending_.empty(); });
+            if (pending_.empty()) {
+                break;  // stop_ && 남은 콜백 없음
+            }
+
+            batch.swap(pending_);
+            lock.unlock();
+
+            synchronize();
+            for (auto& callback : batch) {
+                callback();
+            }
+            std::size_t ran = batch.size();
+            batch.clear();
+
+            lock.lock();
+            completed_ += ran;
+            done_cv_.notify_all();
+        }
+    }
+
+private:
+    // 모든 reader가 읽는 값 → 단독 캐시라인
+    alignas(64) std::atomic<std::uint64_t> gp_{1};
+
+    detail::RecordRegistry<RcuRecord> records_;
+    std::atomic<std::uint64_t> grace_periods_{0};
+    std::mutex sync_mutex_;
+
+    // call_rcu 큐 (queue_mutex_ 보호)
+    std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;
+    std::condition_variable done_cv_;
+    std::vector<std::function<void()>> pending_;
+    std::uint64_t queued_ = 0;
+    std::uint64_t completed_ = 0;
+    bool stop_ = false;
+    std::thread worker_;
+};
+
+// ============================================
+// RcuReader: 스레드 등록 (RAII)
+// ============================================
+// 생성 시 online, 소멸 시 등록 해제
+// 오래 블록될 구간(I/O 대기 등) 앞뒤로 offline()/online()
+class RcuReader {
+public:
+    explicit RcuReader(RcuDomain& domain = RcuDomain::global())
+        : domain_(domain),
+          record_(domain.records_.acquire()) {
+        domain_.online(record_);
+    }
+
+    ~RcuReader() {
+        RcuDomain::offline(record_);
+        detail::RecordRegistry<RcuDomain::RcuRecord>::release(record_);
+    }
+
+    // Non-copyable, non-movable
+    RcuReader(const RcuReader&) = delete;
+    RcuReader& operator=(const RcuReader&) = delete;
+    RcuReader(RcuReader&&) = delete;
+    RcuReader& operator=(RcuReader&&) = delete;
+
+    /**
+     * 이전에 read()로 얻은 포인터를 더 이상 쓰지 않음을 알림
+     */
+    void quiescent_state() {
+        domain_.quiescent_state(record_);
+    }
+
+    /**
+     * 한동안 읽지 않음 → synchronize가 이 스레드를 기다리지 않음
+     */
+    void offline() {
+        RcuDomain::offline(record_);
+    }
+
+    void online() {
+        domain_.online(record_);
+    }
+
+    bool is_online() const {
+        return record_->ctr.load(std::memory_order_relaxed) != RcuDomain::OFFLINE;
+    }
+
+private:
+    RcuDomain& domain_;
+    RcuDomain::RcuRecord* record_;
+};
+
+// ============================================
+// RcuPtr: 읽기 위주 포인터
+// ============================================
+/**
+ * @tparam T       가리키는 타입 (reader에게는 const T*만 노출)
+ * @tparam Deleter 옛 객체 해제 방법 (grace period 후 호출)
+ */
+template <typename T, typename Deleter = std::default_delete<T>>
+class RcuPtr {
+public:
+    explicit RcuPtr(std::unique_ptr<T, Deleter> initial = nullptr,
+                    RcuDomain& domain = RcuDomain::global())
+        : deleter_(initial.get_deleter()),
+          ptr_(initial.release()),
+          domain_(domain) {}
+
+    /**
+     * 읽는 스레드가 없어야 함 → 현재 객체를 바로 해제
+     */
+    ~RcuPtr() {
+        T* current = ptr_.load(std::memory_order_relaxed);
+        if (current != nullptr) {
+            deleter_(current);
+        }
+    }
+
+    // Non-copyable, non-movable
+    RcuPtr(const RcuPtr&) = delete;
+    RcuPtr& operator=(const RcuPtr&) = delete;
+    RcuPtr(RcuPtr&&) = delete;
+    RcuPtr& operator=(RcuPtr&&) = delete;
+
+    /**
+     * 현재 객체 (다음 quiescent_state()까지 유효)
+     *
+     * 락도, 게시도, fence도 없음 → acquire load 하나
+     */
+    const T* read() const {
+        return ptr_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * 새 객체로 교체, 옛 객체는 grace period 후 백그라운드에서 해제
+     */
+    void update(std::unique_ptr<T, Deleter> next) {
+        T* old = ptr_.exchange(next.release(), std::memory_order_acq_rel);
+        if (old != nullptr) {
+            Deleter deleter = deleter_;
+            domain_.call_rcu([old, deleter]() mutable { deleter(old); });
+        }
+    }
+
+    /**
+     * 새 객체로 교체하고 옛 객체 해제까지 호출자가 기다림
+     *
+     * 호출자가 online reader이면 안 됨 (RcuDomain::synchronize 참고)
+     */
+    void update_sync(std::unique_ptr<T, Deleter> next) {
+        T* old = ptr_.exchange(next.release(), std::memory_order_acq_rel);
+        if (old != nullptr) {
+            domain_.synchronize();
+            deleter_(old);
+        }
+    }
+
+    RcuDomain& domain() const {
+        return domain_;
+    }
+
+private:
+    [[no_unique_address]] Deleter deleter_;
+    std::atomic<T*> ptr_;
+    RcuDomain& domain_;
+};
+
+} // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
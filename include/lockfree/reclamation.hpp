@@ -0,0 +1,209 @@
+/**
+ * 메모리 회수 도메인 공통 부품 (hazard_pointer.hpp, epoch.hpp에서 사용)
+ *
+ * 두 방식 모두 같은 뼈대를 가짐:
+ *   - 스레드가 잠깐 차지했다가 반납하는 record 목록 (게시 슬롯)
+ *   - 안전해진 노드를 모아서 reclaimer에 한꺼번에 넘기는 배치
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  RecordRegistry<Record>                                      │
+ * │    head_ ──► [rec] ──► [rec] ──► [rec] ──► nullptr           │
+ * │              active   free     active   ← 만들어지면 불변      │
+ * │                                                              │
+ * │  ReclaimBatch<Node>                                          │
+ * │    [n0][n1] ... [n63]  가득 차면 reclaim(nodes, 64, context)   │
+ * │    → MemoryPool::deallocate_bulk 등이 CAS 한 번으로 반환        │
+ * └─────────────────────────────────────────────────────────────┘
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace lockfree {
+namespace detail {
+
+// ============================================
+// RecordRegistry: 재사용되는 스레드 record 목록
+// ============================================
+/**
+ * Record 요구사항:
+ *   std::atomic<bool> active;   // 차지 여부
+ *   Record* next;               // 목록 링크 (push 후 불변)
+ *
+ * record는 도메인이 끝날 때까지 삭제되지 않음
+ * → scan/advance가 목록을 락 없이 순회할 수 있음
+ */
+template <typename Record>
+class RecordRegistry {
+public:
+    RecordRegistry() : id_(next_registry_id()) {}
+
+    ~RecordRegistry() {
+        Record* rec = head_.load(std::memory_order_acquire);
+        while (rec != nullptr) {
+            assert(!rec->active.load(std::memory_order_relaxed) && "guard outlives its domain");
+            Record* next = rec->next;
+            delete rec;
+            rec = next;
+        }
+    }
+
+    // Non-copyable, non-movable
+    RecordRegistry(const RecordRegistry&) = delete;
+    RecordRegistry& operator=(const RecordRegistry&) = delete;
+    RecordRegistry(RecordRegistry&&) = delete;
+    RecordRegistry& operator=(RecordRegistry&&) = delete;
+
+    /**
+     * 빈 record 차지
+     *
+     * 스레드별 힌트 → 보통 지난번에 쓴 record를 CAS 한 번으로 다시 차지
+     */
+    Record* acquire() {
+        RecordHint* hints = thread_hints();
+        for (std::size_t i = 0; i < HINTS_PER_THREAD; ++i) {
+            if (hints[i].registry_id == id_ && try_activate(hints[i].record)) {
+                return hints[i].record;
+            }
+        }
+
+        Record* rec = nullptr;
+        for (Record* r = head_.load(std::memory_order_acquire); r != nullptr; r = r->next) {
+            if (try_activate(r)) {
+                rec = r;
+                break;
+            }
+        }
+
+        if (rec == nullptr) {
+            rec = new Record();
+            rec->active.store(true, std::memory_order_relaxed);
+            Record* head = head_.load(std::memory_order_relaxed);
+            do {
+                rec->next = head;
+            } while (!head_.compare_exchange_weak(
+                head, rec,
+                std::memory_order_release,
+                std::memory_order_relaxed));
+            count_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // 힌트 갱신: 가장 오래된 칸을 덮어씀
+        RecordHint& slot = hints[hint_cursor()++ % HINTS_PER_THREAD];
+        slot.registry_id = id_;
+        slot.record = rec;
+        return rec;
+    }
+
+    static void release(Record* rec) {
+        rec->active.store(false, std::memory_order_release);
+    }
+
+    /**
+     * 지금까지 만들어진 모든 record 순회 (차지 여부와 무관)
+     */
+    Record* head() const {
+        return head_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * 지금까지 만들어진 record 수 (= 동시에 쓰인 guard 최대 수)
+     */
+    std::size_t size() const {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static bool try_activate(Record* rec) {
+        if (rec->active.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        bool expected = false;
+        return rec->active.compare_exchange_strong(
+            expected, true,
+            std::memory_order_acquire,
+            std::memory_order_relaxed);
+    }
+
+    // ========================================
+    // 스레드별 record 힌트
+    // ========================================
+    // 주소 대신 고유 id로 구분 → 소멸한 도메인의 힌트를 잘못 쓰지 않음
+    static constexpr std::size_t HINTS_PER_THREAD = 4;
+
+    struct RecordHint {
+        std::uint64_t registry_id = 0;
+        Record* record = nullptr;
+    };
+
+    static RecordHint* thread_hints() {
+        thread_local RecordHint hints[HINTS_PER_THREAD];
+        return hints;
+    }
+
+    static std::size_t& hint_cursor() {
+        thread_local std::size_t cursor = 0;
+        return cursor;
+    }
+
+    static std::uint64_t next_registry_id() {
+        static std::atomic<std::uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;  // 0 = 빈 힌트
+    }
+
+private:
+    std::atomic<Record*> head_{nullptr};
+    std::atomic<std::size_t> count_{0};
+    const std::uint64_t id_;
+};
+
+// ============================================
+// ReclaimBatch: reclaimer 호출을 묶음 단위로
+// ============================================
+// 노드 하나마다 reclaimer를 부르면 풀 반환도 노드마다 CAS 한 번
+// → 스택 버퍼에 모았다가 한꺼번에 넘김 (할당 없음)
+template <typename Node, std::size_t Capacity = 64>
+class ReclaimBatch {
+public:
+    using Reclaimer = void (*)(Node* const* nodes, std::size_t count, void* context);
+
+    ReclaimBatch(Reclaimer reclaim, void* context)
+        : reclaim_(reclaim), context_(context) {}
+
+    ~ReclaimBatch() {
+        flush();
+    }
+
+    // Non-copyable, non-movable
+    ReclaimBatch(const ReclaimBatch&) = delete;
+    ReclaimBatch& operator=(const ReclaimBatch&) = delete;
+    ReclaimBatch(ReclaimBatch&&) = delete;
+    ReclaimBatch& operator=(ReclaimBatch&&) = delete;
+
+    void add(Node* node) {
+        nodes_[count_++] = node;
+        if (count_ == Capacity) {
+            flush();
+        }
+    }
+
+    void flush() {
+        if (count_ > 0) {
+            reclaim_(nodes_, count_, context_);
+            count_ = 0;
+        }
+    }
+
+private:
+    Reclaimer reclaim_;
+    void* context_;
+    std::size_t count_ = 0;
+    Node* nodes_[Capacity];
+};
+
+} // namespace detail
+} // namespace lockfree
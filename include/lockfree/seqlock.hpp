@@ -0,0 +1,198 @@
+/**
+ * SeqLock - Sequence Lock for Read-Mostly Small Structs
+ *
+ * 최우선 호가(best bid/ask), 설정 버전 같은 작은 스냅샷을 읽을 때
+ * SpinLock을 잡으면 reader도 락 캐시라인에 "쓰기"를 함
+ * → 읽기만 하는데도 writer와 다른 reader의 캐시라인을 무효화!
+ *
+ * SeqLock 핵심 아이디어:
+ *   reader는 공유 메모리에 절대 쓰지 않음
+ *   대신 "읽는 동안 바뀌었는지" 버전으로 확인하고, 바뀌었으면 재시도
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  Writer                          Reader                      │
+ * │                                                              │
+ * │  seq = 1 (홀수: 쓰는 중)         s1 = seq (짝수여야 함)      │
+ * │  fence(release)                  copy data                   │
+ * │  write data                      fence(acquire)              │
+ * │  seq = 2 (짝수: 완료)            s2 = seq                    │
+ * │                                  s1 == s2 ? 성공 : 재시도    │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * 데이터 경쟁(data race) 없이 복사하기:
+ *   writer와 reader가 동시에 data를 만지므로 일반 memcpy는 UB
+ *   → data를 8바이트 atomic 워드 배열로 저장하고 relaxed로 복사
+ *   → reader 쪽에서 워드 배열을 T로 memcpy (T는 trivially copyable)
+ *
+ * Writer 모드:
+ *   SeqLock<T>        : writer 하나 (동시 store 금지)
+ *   SeqLock<T, true>  : 여러 writer를 SpinLock으로 직렬화
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+
+#include "spinlock.hpp"
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lockfree {
+
+template <typename T, bool MultiWriter = false>
+class SeqLock {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock<T> requires a trivially copyable T");
+    static_assert(std::is_default_constructible_v<T>, "SeqLock<T> requires a default constructible T");
+
+    // T를 덮는 8바이트 워드 수
+    static constexpr std::size_t WORDS = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+    // writer 하나일 때는 락 비용 0
+    struct NoWriterLock {
+        void lock() {}
+        void unlock() {}
+    };
+    using WriterLock = std::conditional_t<MultiWriter, SpinLock, NoWriterLock>;
+
+public:
+    SeqLock() : SeqLock(T{}) {}
+
+    explicit SeqLock(const T& initial) {
+        write_words(initial);
+    }
+
+    // Non-copyable, non-movable
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+    SeqLock(SeqLock&&) = delete;
+    SeqLock& operator=(SeqLock&&) = delete;
+
+    // ============================================
+    // Reader API (공유 메모리에 쓰기 없음)
+    // ============================================
+
+    /**
+     * 일관된 스냅샷 읽기 (writer와 겹치면 재시도)
+     */
+    T load() const {
+        T value;
+        while (!try_load(value)) {
+            SPIN_PAUSE();
+        }
+        return value;
+    }
+
+    /**
+     * 한 번만 시도
+     *
+     * @return writer와 겹치지 않고 읽었으면 true
+     */
+    bool try_load(T& out) const {
+        // acquire: 이 버전을 만든 writer의 data 쓰기가 보임
+        std::uint64_t s1 = seq_.load(std::memory_order_acquire);
+        if (s1 & 1) {
+            return false;  // 쓰는 중
+        }
+
+        std::uint64_t buffer[WORDS];
+        for (std::size_t i = 0; i < WORDS; ++i) {
+            buffer[i] = words_[i].load(std::memory_order_relaxed);
+        }
+
+        // acquire fence: 위의 data 읽기가 아래 seq 재확인보다 먼저 일어나도록
+        std::atomic_thread_fence(std::memory_order_acquire);
+        std::uint64_t s2 = seq_.load(std::memory_order_relaxed);
+        if (s1 != s2) {
+            return false;  // 읽는 동안 writer가 지나감 → 찢어진 값일 수 있음
+        }
+
+        std::memcpy(&out, buffer, sizeof(T));
+        return true;
+    }
+
+    /**
+     * 현재 버전 (짝수 = 안정, 홀수 = 쓰는 중)
+     *
+     * 값이 바뀌었는지 싸게 확인할 때 사용
+     */
+    std::uint64_t version() const {
+        return seq_.load(std::memory_order_acquire);
+    }
+
+    // ============================================
+    // Writer API
+    // ============================================
+
+    void store(const T& value) {
+        std::lock_guard<WriterLock> guard(writer_lock_);
+        write_words(value);
+    }
+
+    /**
+     * Read-Modify-Write (writer 전용)
+     *
+     * writer끼리는 직렬화되므로 현재 값을 재시도 없이 읽을 수 있음
+     *
+     * @param func void(T&) - 값을 직접 수정
+     */
+    template <typename F>
+    void update(F&& func) {
+        std::lock_guard<WriterLock> guard(writer_lock_);
+
+        std::uint64_t buffer[WORDS] = {};
+        for (std::size_t i = 0; i < WORDS; ++i) {
+            buffer[i] = words_[i].load(std::memory_order_relaxed);
+        }
+        T value;
+        std::memcpy(&value, buffer, sizeof(T));
+
+        func(value);
+        write_words(value);
+    }
+
+private:
+    void write_words(const T& value) {
+        std::uint64_t buffer[WORDS] = {};  // 꼬리 패딩을 0으로 (결정적인 값)
+        std::memcpy(buffer, &value, sizeof(T));
+
+        std::uint64_t seq = seq_.load(std::memory_order_relaxed);
+
+        // 1. 홀수로 → reader에게 "쓰는 중"을 알림
+        seq_.store(seq + 1, std::memory_order_relaxed);
+
+        // release fence: 홀수 버전이 아래 data 쓰기보다 먼저 보이도록
+        std::atomic_thread_fence(std::memory_order_release);
+
+        // 2. data 쓰기 (워드 단위 atomic → 데이터 경쟁 없음)
+        for (std::size_t i = 0; i < WORDS; ++i) {
+            words_[i].store(buffer[i], std::memory_order_relaxed);
+        }
+
+        // 3. 짝수로 → release: data 쓰기가 새 버전과 함께 보임
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+private:
+    // 버전 카운터 + data를 같은 캐시라인에서 시작
+    // (reader는 읽기만 하므로 writer의 캐시라인을 무효화하지 않음)
+    alignas(64) std::atomic<std::uint64_t> seq_{0};
+    std::atomic<std::uint64_t> words_[WORDS];
+
+    // writer끼리의 직렬화 (MultiWriter = false면 빈 구조체)
+    WriterLock writer_lock_;
+};
+
+} // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
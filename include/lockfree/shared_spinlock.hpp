@@ -0,0 +1,234 @@
+/**
+ * SharedSpinLock - Reader-Writer Spinlock with Sharded Reader Counts
+ *
+ * 설정/라우팅 테이블처럼 "읽기는 초당 수백만, 쓰기는 가끔"인 데이터에
+ * SpinLock을 쓰면 reader끼리도 직렬화됨
+ *
+ * 단순 RW 락 (reader 카운터 하나):
+ *   reader끼리 배제는 없지만, 모든 reader가 같은 카운터에 fetch_add
+ *   → 카운터 캐시라인이 코어 사이를 핑퐁 (SpinLock과 비슷하게 느림!)
+ *
+ * 해결: reader 카운터를 여러 캐시라인에 분산 (sharding)
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  writers_     : 대기/보유 중인 writer 수 (reader는 읽기만)    │
+ * │  writer_lock_ : writer끼리 직렬화 (SpinLock, futex slow path) │
+ * │                                                              │
+ * │  slot[0]  slot[1]  slot[2]  ...  slot[15]   ← 각자 캐시라인   │
+ * │  [ 2 ]    [ 0 ]    [ 1 ]         [ 0 ]                       │
+ * │    ▲        ▲        ▲                                       │
+ * │  스레드는 고정된 slot 하나에만 fetch_add/fetch_sub           │
+ * │  → reader끼리 캐시라인 공유 없음                              │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * Writer 우선 (starvation 방지):
+ *   writer가 도착하면 writers_를 먼저 올림
+ *   → 새 reader는 writers_ != 0을 보고 물러남
+ *   → 기존 reader만 빠지면 writer 진입
+ *
+ * std::shared_mutex와 같은 인터페이스 (SharedLockable)
+ *   → std::shared_lock / std::unique_lock 사용 가능
+ *
+ * 주의: 같은 스레드의 재귀 lock_shared()는 writer 대기 중 교착 가능
+ *       (std::shared_mutex와 동일한 제약)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "spinlock.hpp"
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lockfree {
+
+class SharedSpinLock {
+public:
+    // reader 카운터 샤드 수 (2의 거듭제곱)
+    static constexpr std::size_t READER_SLOTS = 16;
+    static_assert((READER_SLOTS & (READER_SLOTS - 1)) == 0, "READER_SLOTS must be a power of 2");
+
+    SharedSpinLock() = default;
+
+    // Non-copyable, non-movable
+    SharedSpinLock(const SharedSpinLock&) = delete;
+    SharedSpinLock& operator=(const SharedSpinLock&) = delete;
+    SharedSpinLock(SharedSpinLock&&) = delete;
+    SharedSpinLock& operator=(SharedSpinLock&&) = delete;
+
+    // ============================================
+    // Exclusive (writer) API
+    // ============================================
+
+    void lock() {
+        // 1. 도착 알림 → 이후 reader는 진입하지 않음 (writer 우선)
+        // seq_cst: reader의 (slot 증가 → writers_ 확인)과 Dekker 쌍을 이룸
+        writers_.fetch_add(1, std::memory_order_seq_cst);
+
+        // 2. writer끼리 직렬화 (SpinLock의 TTAS + futex 대기 재사용)
+        writer_lock_.lock();
+
+        // 3. 이미 들어와 있던 reader가 모두 나갈 때까지 대기
+        for (auto& slot : slots_) {
+            wait_until_drained(slot);
+        }
+    }
+
+    bool try_lock() {
+        writers_.fetch_add(1, std::memory_order_seq_cst);
+
+        if (!writer_lock_.try_lock()) {
+            release_writer_intent();
+            return false;
+        }
+
+        for (auto& slot : slots_) {
+            if (slot.readers.load(std::memory_order_seq_cst) != 0) {
+                writer_lock_.unlock();
+                release_writer_intent();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void unlock() {
+        writer_lock_.unlock();
+        release_writer_intent();
+    }
+
+    // ============================================
+    // Shared (reader) API
+    // ============================================
+
+    void lock_shared() {
+        ReaderSlot& slot = slots_[thread_slot_index()];
+
+        while (true) {
+            // writer가 대기/보유 중이면 진입하지 않고 기다림
+            wait_for_no_writers();
+
+            // 내 slot에만 쓰기 → 다른 reader와 캐시라인 경쟁 없음
+            slot.readers.fetch_add(1, std::memory_order_seq_cst);
+
+            // 증가와 writers_ 확인 사이에 writer가 도착했을 수 있음
+            if (writers_.load(std::memory_order_seq_cst) == 0) {
+                return;  // 획득 성공 (writer가 이 reader를 기다려 줌)
+            }
+
+            // writer에게 양보하고 다시 시도
+            leave_slot(slot);
+        }
+    }
+
+    bool try_lock_shared() {
+        if (writers_.load(std::memory_order_seq_cst) != 0) {
+            return false;
+        }
+
+        ReaderSlot& slot = slots_[thread_slot_index()];
+        slot.readers.fetch_add(1, std::memory_order_seq_cst);
+        if (writers_.load(std::memory_order_seq_cst) == 0) {
+            return true;
+        }
+
+        leave_slot(slot);
+        return false;
+    }
+
+    void unlock_shared() {
+        leave_slot(slots_[thread_slot_index()]);
+    }
+
+private:
+    /**
+     * reader 카운터 샤드 (캐시라인 하나씩 차지)
+     */
+    struct alignas(64) ReaderSlot {
+        std::atomic<std::uint32_t> readers{0};
+    };
+
+    /**
+     * 스레드별 고정 slot 인덱스
+     *
+     * 실행 중인 코어(getcpu) 대신 스레드 단위로 고정:
+     * lock_shared와 unlock_shared 사이에 다른 코어로 옮겨져도
+     * 같은 slot에서 증가/감소해야 하기 때문
+     */
+    static std::size_t thread_slot_index() {
+        static std::atomic<std::size_t> next_index{0};
+        thread_local const std::size_t index =
+            next_index.fetch_add(1, std::memory_order_relaxed) & (READER_SLOTS - 1);
+        return index;
+    }
+
+    void leave_slot(ReaderSlot& slot) {
+        std::uint32_t prev = slot.readers.fetch_sub(1, std::memory_order_seq_cst);
+
+        // 마지막 reader이고 writer가 기다리는 중이면 깨움
+        if (prev == 1 && writers_.load(std::memory_order_seq_cst) != 0) {
+            slot.readers.notify_all();
+        }
+    }
+
+    void release_writer_intent() {
+        // 마지막 writer가 나가면 대기 중인 reader들을 깨움
+        if (writers_.fetch_sub(1, std::memory_order_seq_cst) == 1) {
+            writers_.notify_all();
+        }
+    }
+
+    void wait_for_no_writers() {
+        for (int spin = 0; spin < spin_count_; ++spin) {
+            if (writers_.load(std::memory_order_seq_cst) == 0) {
+                return;
+            }
+            SPIN_PAUSE();
+        }
+
+        std::uint32_t writers;
+        while ((writers = writers_.load(std::memory_order_seq_cst)) != 0) {
+            writers_.wait(writers, std::memory_order_seq_cst);
+        }
+    }
+
+    void wait_until_drained(ReaderSlot& slot) {
+        for (int spin = 0; spin < spin_count_; ++spin) {
+            if (slot.readers.load(std::memory_order_seq_cst) == 0) {
+                return;
+            }
+            SPIN_PAUSE();
+        }
+
+        std::uint32_t readers;
+        while ((readers = slot.readers.load(std::memory_order_seq_cst)) != 0) {
+            slot.readers.wait(readers, std::memory_order_seq_cst);
+        }
+    }
+
+private:
+    // 대기 + 보유 중인 writer 수 (32비트: futex 대기 가능)
+    alignas(64) std::atomic<std::uint32_t> writers_{0};
+
+    // writer끼리의 상호 배제
+    SpinLock writer_lock_;
+
+    // reader 카운터 샤드
+    ReaderSlot slots_[READER_SLOTS];
+
+    // 스핀 횟수 (SpinLock과 동일)
+    static constexpr int spin_count_ = 32;
+};
+
+} // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -2,31 +2,58 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <thread>
 
-// 플랫폼별 pause 명령어 정의
-#if defined(_MSC_VER)
-    #include <intrin.h>
-    #define SPIN_PAUSE() _mm_pause()
-#elif defined(__x86_64__) || defined(__i386__)
-    #define SPIN_PAUSE() __builtin_ia32_pause()
-#elif defined(__arm__) || defined(__aarch64__)
-    #define SPIN_PAUSE() __asm__ __volatile__("yield")
-#else
-    #define SPIN_PAUSE() ((void)0)
-#endif
+#include "backoff.hpp"        // SPIN_PAUSE(), Backoff 정책
+#include "lock_profiler.hpp"  // LOCKFREE_LOCK_PROFILING 훅
 
 namespace lockfree {
 
-class SpinLock {
+namespace detail {
+
+// 상태 없는 Backoff 정책용 빈 상태 ([[no_unique_address]]로 크기 0)
+struct NoSpinState {};
+
+template <typename B>
+struct spin_state {
+    using type = NoSpinState;
+};
+
+template <StatefulBackoffPolicy B>
+struct spin_state<B> {
+    using type = typename B::state_type;
+};
+
+} // namespace detail
+
+/**
+ * BasicSpinLock
+ *
+ * @tparam Backoff 스핀 단계의 물러나기 전략 (backoff.hpp)
+ *                 should_block()이 true가 되면 OS 대기로 전환
+ *                 (NoBackoff/Exponential 등은 블록하지 않고 계속 스핀)
+ *                 StatefulBackoffPolicy면 락마다 상태를 하나 두고 학습
+ *                 (AdaptiveBackoff: 스핀 횟수 이동 평균)
+ *
+ * LOCKFREE_LOCK_PROFILING이 정의되면 락마다 경합 통계를 기록 (lock_profiler.hpp)
+ * 이름을 주면 LockProfiler 보고서에 그 이름으로 나옴
+ */
+template <BackoffPolicy Backoff>
+class BasicSpinLock {
 public:
-    SpinLock() = default;
+    using backoff_type = Backoff;
+
+    constexpr BasicSpinLock() : profile_(nullptr, this) {}
+
+    // 프로파일링 빌드에서 보고서에 쓸 이름 (꺼져 있으면 무시됨)
+    constexpr explicit BasicSpinLock(const char* name) : profile_(name, this) {}
     
     // Non-copyable, non-movable
-    SpinLock(const SpinLock&) = delete;
-    SpinLock& operator=(const SpinLock&) = delete;
-    SpinLock(SpinLock&&) = delete;
-    SpinLock& operator=(SpinLock&&) = delete;
+    BasicSpinLock(const BasicSpinLock&) = delete;
+    BasicSpinLock& operator=(const BasicSpinLock&) = delete;
+    BasicSpinLock(BasicSpinLock&&) = delete;
+    BasicSpinLock& operator=(BasicSpinLock&&) = delete;
     
     void lock() {
         // ============================================
@@ -36,6 +63,7 @@ public:
         // exchange는 atomic하게 true로 설정하고 이전 값을 반환
         // 이전 값이 false였다면 = 락이 풀려있었다면 = 획득 성공!
         if (!locked_.exchange(true, std::memory_order_acquire)) {
+            profile_.on_acquired();
             return;  // 락 획득 성공, 즉시 반환
         }
         
@@ -43,9 +71,13 @@ public:
         // 2단계: Spin with TTAS (Test-and-Test-and-Set)
         // ============================================
         // 짧은 시간 동안 스핀하면서 락 획득 시도
-        // 왜 32번? -> 컨텍스트 스위치 비용보다 작은 시간 동안만 스핀
-        // 이 값은 튜닝 가능 (16~64 정도가 일반적)
-        for (int spin = 0; spin < spin_count_; ++spin) {
+        // 얼마나 스핀할지는 Backoff 정책이 결정
+        // 기본값 HybridBackoff<32>: 32번 pause 후 OS 대기
+        // -> 컨텍스트 스위치 비용보다 작은 시간 동안만 스핀
+        const std::uint64_t wait_start = profile_.now();
+        std::uint32_t spins = 0;
+        Backoff backoff = make_backoff();
+        while (!backoff.should_block()) {
             
             // TTAS의 핵심: 먼저 "읽기만" 수행
             // load는 캐시에서 읽기만 하므로 다른 CPU 캐시를 오염시키지 않음
@@ -55,6 +87,8 @@ public:
                 // 락이 풀린 것 같다! 실제로 획득 시도
                 // 이때만 exchange(쓰기 연산) 수행
                 if (!locked_.exchange(true, std::memory_order_acquire)) {
+                    on_acquired(backoff);
+                    profile_.on_acquired(wait_start, spins, false);
                     return;  // 락 획득 성공!
                 }
                 // 다른 스레드가 먼저 가져갔다면 다시 스핀
@@ -63,7 +97,9 @@ public:
             // CPU에게 "나 스핀 중이야"라고 알려줌
             // x86: pause 명령어 - 파이프라인 최적화, 전력 절약
             // ARM: yield 명령어 - 다른 스레드에게 양보
-            SPIN_PAUSE();
+            // 정책에 따라 pause 횟수가 늘어나거나 yield로 바뀜
+            backoff.pause();
+            ++spins;
         }
         
         // ============================================
@@ -72,21 +108,30 @@ public:
         // 스핀으로도 못 얻었다면 = 경합이 심한 상황
         // CPU 낭비하지 말고 OS에게 대기를 맡김
         lock_slow_path();
+        on_acquired(backoff);
+        profile_.on_acquired(wait_start, spins, true);
     }
     
     bool try_lock() {
         // 딱 한 번만 시도하고 결과 반환
         // 현재 값이 false(잠금 해제)인 경우에만 true로 변경
         bool expected = false;
-        return locked_.compare_exchange_strong(
-            expected, 
-            true, 
-            std::memory_order_acquire,   // 성공 시: acquire
-            std::memory_order_relaxed    // 실패 시: relaxed (어차피 아무것도 안 함)
-        );
+        if (locked_.compare_exchange_strong(
+                expected,
+                true,
+                std::memory_order_acquire,   // 성공 시: acquire
+                std::memory_order_relaxed    // 실패 시: relaxed (어차피 아무것도 안 함)
+            )) {
+            profile_.on_acquired();
+            return true;
+        }
+        return false;
     }
     
     void unlock() {
+        // 보유 시간 기록은 해제 전에 (보유자만 통계를 씀)
+        profile_.on_release();
+
         // 락 해제
         // release: 이 store 이전의 모든 메모리 연산이 완료됨을 보장
         locked_.store(false, std::memory_order_release);
@@ -95,8 +140,32 @@ public:
         // 대기 중인 스레드가 없으면 아무 일도 안 함 (오버헤드 최소)
         locked_.notify_one();
     }
-    
+
+    /**
+     * 락이 잡혀 있는지 (근사값, 읽기만 하므로 캐시라인을 더럽히지 않음)
+     *
+     * try_lock() 전에 확인하면 TTAS처럼 불필요한 쓰기를 줄일 수 있음
+     */
+    bool is_locked() const {
+        return locked_.load(std::memory_order_relaxed);
+    }
+
 private:
+    Backoff make_backoff() {
+        if constexpr (StatefulBackoffPolicy<Backoff>) {
+            return Backoff(spin_state_);
+        } else {
+            return Backoff{};
+        }
+    }
+
+    // 락을 쥔 상태에서 호출 → 정책 상태 갱신은 자동으로 직렬화됨
+    static void on_acquired(Backoff& backoff) {
+        if constexpr (StatefulBackoffPolicy<Backoff>) {
+            backoff.on_acquired();
+        }
+    }
+
     // Slow path: OS 레벨 대기
     // [[gnu::noinline]]이나 __declspec(noinline)로 
     // 이 함수를 인라인하지 않게 하면 fast path가 더 최적화됨
@@ -122,19 +191,31 @@ private:
 private:
     // 락 상태: false = 잠금 해제, true = 잠금
     alignas(64) std::atomic<bool> locked_{false};  // 캐시라인 정렬
-    
-    // 스핀 횟수 (튜닝 가능)
-    static constexpr int spin_count_ = 32;
+
+    // Backoff 정책의 락별 상태 (locked_와 같은 캐시라인, 없으면 크기 0)
+    [[no_unique_address]] typename detail::spin_state<Backoff>::type spin_state_;
+
+    // 경합 통계 (LOCKFREE_LOCK_PROFILING 없으면 빈 구조체, 크기 0)
+    [[no_unique_address]] detail::SpinLockProfile profile_;
 };
 
+// 기본 SpinLock: 32번 스핀 후 futex 대기 (튜닝 가능, 16~64 정도가 일반적)
+using SpinLock = BasicSpinLock<HybridBackoff<32, 0>>;
+
+// 적응형 SpinLock: 락마다 "보통 몇 번 스핀하면 얻는지" 학습
+// 짧게 잡히는 락은 더 오래 스핀, 오래 잡히는 락은 거의 곧바로 futex 대기
+using AdaptiveSpinLock = BasicSpinLock<AdaptiveBackoff<>>;
+
 // ============================================
 // RAII wrapper for SpinLock
 // ============================================
 // 생성자에서 lock(), 소멸자에서 unlock() 자동 호출
 // 예외가 발생해도 unlock()이 보장됨
+// CTAD: SpinLockGuard guard(lock); 으로 어떤 BasicSpinLock이든 사용 가능
+template <typename Lock = SpinLock>
 class SpinLockGuard {
 public:
-    explicit SpinLockGuard(SpinLock& lock) : lock_(lock) {
+    explicit SpinLockGuard(Lock& lock) : lock_(lock) {
         lock_.lock();
     }
     
@@ -149,7 +230,7 @@ public:
     SpinLockGuard& operator=(SpinLockGuard&&) = delete;
     
 private:
-    SpinLock& lock_;
+    Lock& lock_;
 };
 
 } // namespace lockfree
\ No newline at end of file
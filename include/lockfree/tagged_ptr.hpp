@@ -0,0 +1,323 @@
+/**
+ * Tagged Pointer - ABA 방지용 (포인터, 버전 태그) 원자 쌍
+ *
+ * Treiber 스택/free list의 CAS는 "head가 아직 A인가"만 봄
+ * → A가 빠졌다가 다시 들어오면(ABA) 틀린 next로 성공
+ * → 포인터와 함께 매 연산마다 증가하는 태그를 한 번의 CAS로 비교
+ *
+ * 두 가지 저장 방식 (값 인터페이스는 TaggedPtr<T>로 동일):
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  Wide (기본, 128비트 CAS 가능 시)                             │
+ * │  ┌──────────────────────────┬──────────────────────────┐    │
+ * │  │ pointer (64비트)          │ tag (64비트)              │    │
+ * │  └──────────────────────────┴──────────────────────────┘    │
+ * │  - x86-64 cmpxchg16b (-mcx16), ARM64 ldxp/stxp 또는 casp      │
+ * │  - 태그가 사실상 한 바퀴 돌지 않음 (2^64 연산)                   │
+ * │  - 주소 폭 가정 없음 (5-level paging/LA57에서도 안전)            │
+ * │                                                              │
+ * │  Packed (fallback)                                           │
+ * │  ┌────────────┬─────────────────────────────────────────┐   │
+ * │  │ tag (16)   │ pointer (48비트)                          │   │
+ * │  └────────────┴─────────────────────────────────────────┘   │
+ * │  - 64비트 CAS만 있으면 됨                                      │
+ * │  - 태그는 65536 연산마다 한 바퀴 (그 사이 정확히 같은 태그로       │
+ * │    돌아오는 ABA는 못 막음)                                      │
+ * │  - 포인터가 48비트를 넘으면 저장 불가 → 런타임 검사 후 abort        │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * Wide 방식의 load:
+ *   128비트를 한 번에 읽는 명령은 x86-64에 없음 (cmpxchg16b로 읽으면 쓰기가 됨)
+ *   → 64비트 반쪽을 각각 atomic으로 읽음. 찢어진 값(다른 시점의 ptr/tag)은
+ *     이어지는 CAS가 실패하면서 걸러짐 (CAS는 항상 128비트 전체를 비교)
+ *
+ * 선택:
+ *   AtomicTaggedPtr<T> = 128비트 CAS가 lock-free로 컴파일되면 Wide, 아니면 Packed
+ *   GCC/Clang x86-64는 -mcx16 필요 (CMake 옵션 LOCKFREE_DWCAS, 기본 ON)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+// 128비트 CAS를 lock-free 명령으로 쓸 수 있는지
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+#define LOCKFREE_HAS_DWCAS 1
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define LOCKFREE_HAS_DWCAS 1
+#else
+#define LOCKFREE_HAS_DWCAS 0
+#endif
+
+namespace lockfree {
+
+/**
+ * (포인터, 태그) 값
+ *
+ * 저장 방식과 무관한 논리 값. Packed 저장소에서 읽으면 태그는 하위 16비트만 남음
+ * → 태그는 "같은지"만 비교하고 크기 비교에 쓰지 않아야 함
+ */
+template <typename T>
+class TaggedPtr {
+public:
+    using tag_type = std::uint64_t;
+
+    constexpr TaggedPtr() noexcept = default;
+    constexpr TaggedPtr(T* ptr, tag_type tag) noexcept : ptr_(ptr), tag_(tag) {}
+
+    constexpr T* ptr() const noexcept { return ptr_; }
+    constexpr tag_type tag() const noexcept { return tag_; }
+
+    /**
+     * 같은 자리를 새 포인터로 바꾼 다음 값 (태그 + 1)
+     */
+    constexpr TaggedPtr advanced(T* ptr) const noexcept {
+        return TaggedPtr(ptr, tag_ + 1);
+    }
+
+    friend constexpr bool operator==(const TaggedPtr&, const TaggedPtr&) = default;
+
+private:
+    T* ptr_ = nullptr;
+    tag_type tag_ = 0;
+};
+
+namespace detail {
+
+/**
+ * Packed 저장소에 들어가지 않는 주소 (48비트 초과)
+ *
+ * assert와 달리 릴리스 빌드에서도 검사: 조용히 잘린 포인터로 CAS하면
+ * 엉뚱한 메모리를 free list에 연결하게 됨
+ */
+[[noreturn]] inline void packed_address_overflow(const void* ptr) {
+    std::fprintf(stderr,
+                 "lockfree: pointer %p does not fit in 48 bits; "
+                 "packed tagged pointers need 128-bit CAS on this system (LA57?)\n",
+                 ptr);
+    std::abort();
+}
+
+} // namespace detail
+
+// ============================================
+// Packed: 16비트 태그 + 48비트 포인터 (64비트 CAS)
+// ============================================
+template <typename T>
+class PackedAtomicTaggedPtr {
+public:
+    using value_type = TaggedPtr<T>;
+
+    static constexpr int TAG_BITS = 16;
+    static constexpr int PTR_BITS = 48;
+    static constexpr bool is_always_lock_free = std::atomic<std::uint64_t>::is_always_lock_free;
+
+    constexpr PackedAtomicTaggedPtr() noexcept : word_(0) {}
+    explicit PackedAtomicTaggedPtr(value_type value) noexcept : word_(pack(value)) {}
+
+    // Non-copyable, non-movable
+    PackedAtomicTaggedPtr(const PackedAtomicTaggedPtr&) = delete;
+    PackedAtomicTaggedPtr& operator=(const PackedAtomicTaggedPtr&) = delete;
+    PackedAtomicTaggedPtr(PackedAtomicTaggedPtr&&) = delete;
+    PackedAtomicTaggedPtr& operator=(PackedAtomicTaggedPtr&&) = delete;
+
+    value_type load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+        return unpack(word_.load(order));
+    }
+
+    void store(value_type value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+        word_.store(pack(value), order);
+    }
+
+    bool compare_exchange_weak(value_type& expected, value_type desired,
+                               std::memory_order success, std::memory_order failure) noexcept {
+        std::uint64_t raw = pack(expected);
+        bool ok = word_.compare_exchange_weak(raw, pack(desired), success, failure);
+        if (!ok) {
+            expected = unpack(raw);
+        }
+        return ok;
+    }
+
+    bool compare_exchange_strong(value_type& expected, value_type desired,
+                                 std::memory_order success, std::memory_order failure) noexcept {
+        std::uint64_t raw = pack(expected);
+        bool ok = word_.compare_exchange_strong(raw, pack(desired), success, failure);
+        if (!ok) {
+            expected = unpack(raw);
+        }
+        return ok;
+    }
+
+    bool is_lock_free() const noexcept {
+        return word_.is_lock_free();
+    }
+
+private:
+    static constexpr std::uint64_t PTR_MASK = (std::uint64_t{1} << PTR_BITS) - 1;
+
+    static std::uint64_t pack(value_type value) noexcept {
+        auto addr = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(value.ptr()));
+        if ((addr & ~PTR_MASK) != 0) [[unlikely]] {
+            detail::packed_address_overflow(value.ptr());
+        }
+        return addr | (value.tag() << PTR_BITS);
+    }
+
+    static value_type unpack(std::uint64_t word) noexcept {
+        return value_type(reinterpret_cast<T*>(static_cast<std::uintptr_t>(word & PTR_MASK)),
+                          word >> PTR_BITS);
+    }
+
+    std::atomic<std::uint64_t> word_;
+};
+
+#if LOCKFREE_HAS_DWCAS
+
+// ============================================
+// Wide: 64비트 포인터 + 64비트 태그 (128비트 CAS)
+// ============================================
+template <typename T>
+class WideAtomicTaggedPtr {
+public:
+    using value_type = TaggedPtr<T>;
+
+    static constexpr int TAG_BITS = 64;
+    static constexpr bool is_always_lock_free = true;
+
+    constexpr WideAtomicTaggedPtr() noexcept : words_{} {}
+    explicit WideAtomicTaggedPtr(value_type value) noexcept : words_{} {
+        words_.half[PTR_HALF] = to_word(value.ptr());
+        words_.half[TAG_HALF] = value.tag();
+    }
+
+    // Non-copyable, non-movable
+    WideAtomicTaggedPtr(const WideAtomicTaggedPtr&) = delete;
+    WideAtomicTaggedPtr& operator=(const WideAtomicTaggedPtr&) = delete;
+    WideAtomicTaggedPtr(WideAtomicTaggedPtr&&) = delete;
+    WideAtomicTaggedPtr& operator=(WideAtomicTaggedPtr&&) = delete;
+
+    /**
+     * 두 반쪽을 각각 읽음 → 찢어질 수 있음 (CAS가 검증)
+     *
+     * 태그를 먼저 acquire로 읽음: 그 뒤 포인터를 읽기 전에 값이 바뀌었다면
+     * 태그도 바뀌었으므로 이 값으로 하는 CAS는 반드시 실패
+     */
+    value_type load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+        std::uint64_t tag = load_half(TAG_HALF, std::memory_order_acquire);
+        std::uint64_t ptr = load_half(PTR_HALF, order);
+        return value_type(from_word(ptr), tag);
+    }
+
+    /**
+     * 경쟁 없이 초기화할 때용 (CAS 루프)
+     */
+    void store(value_type value, std::memory_order /*order*/ = std::memory_order_seq_cst) noexcept {
+        value_type expected = load(std::memory_order_relaxed);
+        while (!compare_exchange_weak(expected, value,
+                                      std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        }
+    }
+
+    // 128비트 CAS는 항상 full barrier → memory_order 인자는 인터페이스 호환용
+    bool compare_exchange_weak(value_type& expected, value_type desired,
+                               std::memory_order success, std::memory_order failure) noexcept {
+        return compare_exchange_strong(expected, desired, success, failure);
+    }
+
+    bool compare_exchange_strong(value_type& expected, value_type desired,
+                                 std::memory_order /*success*/, std::memory_order /*failure*/) noexcept {
+        std::uint64_t exp_ptr = to_word(expected.ptr());
+        std::uint64_t exp_tag = expected.tag();
+        bool ok = cas128(exp_ptr, exp_tag, to_word(desired.ptr()), desired.tag());
+        if (!ok) {
+            expected = value_type(from_word(exp_ptr), exp_tag);
+        }
+        return ok;
+    }
+
+    bool is_lock_free() const noexcept {
+        return true;
+    }
+
+private:
+    // little-endian: 하위 64비트 = 포인터, 상위 64비트 = 태그
+    static constexpr int PTR_HALF = 0;
+    static constexpr int TAG_HALF = 1;
+
+    static std::uint64_t to_word(T* ptr) noexcept {
+        return static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(ptr));
+    }
+
+    static T* from_word(std::uint64_t word) noexcept {
+        return reinterpret_cast<T*>(static_cast<std::uintptr_t>(word));
+    }
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    std::uint64_t load_half(int index, std::memory_order /*order*/) const noexcept {
+        // x64: 정렬된 8바이트 load는 원자적, acquire는 컴파일러 배리어로 충분
+        std::uint64_t value = static_cast<std::uint64_t>(
+            __iso_volatile_load64(reinterpret_cast<const volatile __int64*>(&words_.half[index])));
+        _ReadWriteBarrier();
+        return value;
+    }
+
+    bool cas128(std::uint64_t& exp_ptr, std::uint64_t& exp_tag,
+                std::uint64_t new_ptr, std::uint64_t new_tag) noexcept {
+        __int64 comparand[2] = {static_cast<__int64>(exp_ptr), static_cast<__int64>(exp_tag)};
+        bool ok = _InterlockedCompareExchange128(
+            reinterpret_cast<volatile __int64*>(words_.half),
+            static_cast<__int64>(new_tag), static_cast<__int64>(new_ptr), comparand) != 0;
+        exp_ptr = static_cast<std::uint64_t>(comparand[0]);
+        exp_tag = static_cast<std::uint64_t>(comparand[1]);
+        return ok;
+    }
+
+    struct alignas(16) Words {
+        std::uint64_t half[2];
+    };
+#else
+    __extension__ typedef unsigned __int128 uint128;
+
+    std::uint64_t load_half(int index, std::memory_order order) const noexcept {
+        int gcc_order = (order == std::memory_order_relaxed) ? __ATOMIC_RELAXED : __ATOMIC_ACQUIRE;
+        return __atomic_load_n(&words_.half[index], gcc_order);
+    }
+
+    bool cas128(std::uint64_t& exp_ptr, std::uint64_t& exp_tag,
+                std::uint64_t new_ptr, std::uint64_t new_tag) noexcept {
+        uint128 expected = (static_cast<uint128>(exp_tag) << 64) | exp_ptr;
+        uint128 desired = (static_cast<uint128>(new_tag) << 64) | new_ptr;
+        uint128 actual = __sync_val_compare_and_swap(&words_.whole, expected, desired);
+        exp_ptr = static_cast<std::uint64_t>(actual);
+        exp_tag = static_cast<std::uint64_t>(actual >> 64);
+        return actual == expected;
+    }
+
+    union alignas(16) Words {
+        uint128 whole;
+        std::uint64_t half[2];
+    };
+#endif
+
+    Words words_;
+};
+
+template <typename T>
+using AtomicTaggedPtr = WideAtomicTaggedPtr<T>;
+
+#else
+
+template <typename T>
+using AtomicTaggedPtr = PackedAtomicTaggedPtr<T>;
+
+#endif // LOCKFREE_HAS_DWCAS
+
+} // namespace lockfree
@@ -0,0 +1,288 @@
+/**
+ * Task Graph - JobSystem 위의 의존성 그래프(DAG) 실행기
+ *
+ * Job::parent는 트리(fork-join)만, Counter는 "N개 끝나길 기다림"만 표현
+ * → 한 노드가 여러 선행 노드를 기다리는 그래프(프레임 그래프, ETL 단계)는 표현 못 함
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │            ┌──► [shadow] ──┐                                │
+ * │  [cull] ───┤               ├──► [lighting] ──► [post]       │
+ * │            └──► [gbuffer] ─┘       pending = 2               │
+ * │                                                              │
+ * │  노드마다 pending = 선행 노드 수 (실행마다 다시 채움)            │
+ * │  노드 실행 후 후속 노드마다 pending.fetch_sub(1)                │
+ * │  → 0으로 만든 스레드가 그 노드를 JobSystem에 예약               │
+ * │    (예약이 거부되면 그 스레드가 작업 목록에 넣고 직접 실행)       │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ *   - 중앙 스케줄러 없음: 마지막 선행 노드를 끝낸 워커가 바로 예약
+ *   - 다시 실행 가능: 그래프는 한 번 만들고, run()은 pending만 재설정
+ *     (노드/간선/Job 캡처 모두 할당 없음, Job은 JobSystem 풀에서)
+ *   - 순환은 그래프가 바뀐 뒤 첫 run()에서 한 번 검사 → run()이 false
+ *
+ * 사용 예:
+ *   TaskGraph graph;
+ *   auto cull     = graph.add_node([&] { cull_objects(); });
+ *   auto shadow   = graph.add_node([&] { render_shadows(); });
+ *   auto gbuffer  = graph.add_node([&] { render_gbuffer(); });
+ *   auto lighting = graph.add_node([&] { resolve_lighting(); });
+ *   graph.add_edge(cull, shadow);
+ *   graph.add_edge(cull, gbuffer);
+ *   graph.add_edge(shadow, lighting);
+ *   graph.add_edge(gbuffer, lighting);
+ *
+ *   while (running) {
+ *       graph.run(js);   // 매 프레임 같은 그래프
+ *   }
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "job_system.hpp"
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lockfree {
+
+/**
+ * 의존성 그래프
+ *
+ * 만들기(add_node/add_edge)와 run()은 같은 스레드에서 번갈아 호출
+ * (run() 도중에 그래프를 바꾸거나 같은 그래프를 동시에 run()하면 안 됨)
+ */
+class TaskGraph {
+public:
+    using NodeId = std::size_t;
+
+    TaskGraph() = default;
+
+    // 복사/이동 금지 (실행 중 Job이 this를 캡처)
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+    TaskGraph(TaskGraph&&) = delete;
+    TaskGraph& operator=(TaskGraph&&) = delete;
+
+    // ========================================
+    // 그래프 만들기
+    // ========================================
+
+    /**
+     * 노드 추가
+     *
+     * @param func 노드가 실행할 함수 (run()마다 한 번씩 호출)
+     * @return 노드 ID (add_edge에 사용)
+     *
+     * 함수는 std::function에 보관 → 캡처 크기 제한 없음
+     * (할당은 만들 때 한 번, run()은 할당하지 않음)
+     */
+    template <typename F>
+    NodeId add_node(F&& func) {
+        nodes_.push_back(std::make_unique<Node>(std::forward<F>(func)));
+        dirty_ = true;
+        return nodes_.size() - 1;
+    }
+
+    /**
+     * 의존성 추가: from이 끝난 뒤에 to 실행
+     */
+    void add_edge(NodeId from, NodeId to) {
+        assert(from < nodes_.size() && to < nodes_.size() && "TaskGraph: unknown node");
+        assert(from != to && "TaskGraph: self edge is a cycle");
+
+        nodes_[from]->successors.push_back(to);
+        ++nodes_[to]->predecessors;
+        ++edge_count_;
+        dirty_ = true;
+    }
+
+    // ========================================
+    // 실행
+    // ========================================
+
+    /**
+     * 모든 노드를 의존성 순서대로 실행하고 끝날 때까지 기다림
+     *
+     * 선행 노드가 없는 노드부터 예약, 이후에는 마지막 선행 노드를 끝낸
+     * 워커가 후속 노드를 예약. 호출 스레드는 기다리는 동안 다른 Job을 실행
+     * (워커 안에서 호출해도 교착 없음)
+     *
+     * @return false = 그래프에 순환이 있음 (아무 노드도 실행하지 않음)
+     */
+    bool run(JobSystem& js) {
+        if (dirty_) {
+            prepare();
+        }
+        if (!acyclic_) {
+            return false;
+        }
+
+        for (auto& node : nodes_) {
+            node->pending.store(node->predecessors, std::memory_order_relaxed);
+        }
+
+        Counter done(0);
+        RunContext context{this, &js, &done};
+        for (Node* root : roots_) {
+            launch(context, root);
+        }
+        // 노드 Job이 후속 노드를 예약(counter 증가)한 뒤에 끝나므로
+        // counter가 0 = 그래프 전체 완료
+        js.wait_for_counter(&done);
+        return true;
+    }
+
+    // ========================================
+    // 조회
+    // ========================================
+
+    std::size_t node_count() const {
+        return nodes_.size();
+    }
+
+    std::size_t edge_count() const {
+        return edge_count_;
+    }
+
+    /**
+     * 순환이 없는지 (그래프가 바뀌었으면 다시 검사)
+     */
+    bool is_acyclic() {
+        if (dirty_) {
+            prepare();
+        }
+        return acyclic_;
+    }
+
+private:
+    /**
+     * 노드 (캐시라인 하나 이상: 이웃 노드의 pending을 다른 워커가 동시에 감소)
+     */
+    struct alignas(64) Node {
+        template <typename F>
+        explicit Node(F&& func) : function(std::forward<F>(func)) {}
+
+        std::atomic<std::int32_t> pending{0};    // 이번 실행에서 남은 선행 노드 수
+        std::int32_t predecessors = 0;            // 전체 선행 노드 수 (run마다 pending 초기값)
+        std::function<void()> function;
+        std::vector<NodeId> successors;
+        Node* next_ready = nullptr;               // 인라인 작업 목록 링크 (실행마다 한 번만 준비 → 한 목록에만 속함)
+    };
+
+    /**
+     * run() 한 번의 상태 (호출자 스택, Job은 포인터만 캡처)
+     */
+    struct RunContext {
+        TaskGraph* graph;
+        JobSystem* js;
+        Counter* done;
+    };
+
+    // 노드 Job 예약 (거부되면 그 자리에서 실행)
+    static void launch(const RunContext& context, Node* node) {
+        if (!schedule(context, node)) {
+            run_inline(context, node);
+        }
+    }
+
+    static bool schedule(const RunContext& context, Node* node) {
+        const RunContext* shared = &context;
+        return context.js->schedule([shared, node]() {
+            run_inline(*shared, node);
+        }, context.done);
+    }
+
+    /**
+     * node와, 그 뒤로 준비됐지만 예약이 거부된 후속 노드들을 이 스레드에서 실행
+     *
+     * 재귀 대신 작업 목록 → 거부가 이어져도 스택 깊이는 사슬 길이와 무관
+     * (목록은 Node::next_ready로 엮음 → 할당 없음)
+     */
+    static void run_inline(const RunContext& context, Node* node) {
+        node->next_ready = nullptr;
+        Node* worklist = node;
+        while (worklist != nullptr) {
+            Node* current = worklist;
+            worklist = current->next_ready;
+            worklist = execute(context, current, worklist);
+        }
+    }
+
+    /**
+     * 노드 실행 후 준비된 후속 노드 예약
+     *
+     * @return 예약이 거부된 후속 노드를 앞에 붙인 worklist (호출자가 이어서 실행)
+     */
+    static Node* execute(const RunContext& context, Node* node, Node* worklist) {
+        if (node->function) {
+            node->function();
+        }
+        for (NodeId id : node->successors) {
+            Node* next = context.graph->nodes_[id].get();
+            // acq_rel: 선행 노드들의 결과가 마지막에 0으로 만든 스레드(→ 후속 노드)에 보임
+            if (next->pending.fetch_sub(1, std::memory_order_acq_rel) == 1 && !schedule(context, next)) {
+                next->next_ready = worklist;
+                worklist = next;
+            }
+        }
+        return worklist;
+    }
+
+    /**
+     * 그래프가 바뀐 뒤 한 번: 시작 노드 목록 + 순환 검사 (Kahn 위상 정렬)
+     */
+    void prepare() {
+        roots_.clear();
+        std::vector<std::int32_t> remaining;
+        remaining.reserve(nodes_.size());
+        std::vector<NodeId> ready;
+
+        for (NodeId id = 0; id < nodes_.size(); ++id) {
+            remaining.push_back(nodes_[id]->predecessors);
+            if (nodes_[id]->predecessors == 0) {
+                roots_.push_back(nodes_[id].get());
+                ready.push_back(id);
+            }
+        }
+
+        std::size_t visited = 0;
+        while (!ready.empty()) {
+            NodeId id = ready.back();
+            ready.pop_back();
+            ++visited;
+            for (NodeId next : nodes_[id]->successors) {
+                if (--remaining[next] == 0) {
+                    ready.push_back(next);
+                }
+            }
+        }
+
+        acyclic_ = visited == nodes_.size();
+        dirty_ = false;
+    }
+
+private:
+    std::vector<std::unique_ptr<Node>> nodes_;  // 노드 주소 고정 (실행 중인 Job이 Node*를 캡처)
+    std::vector<Node*> roots_;                  // 선행 노드가 없는 노드 (prepare에서 계산)
+    std::size_t edge_count_ = 0;
+    bool dirty_ = false;
+    bool acyclic_ = true;
+};
+
+} // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
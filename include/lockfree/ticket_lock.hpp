@@ -0,0 +1,179 @@
+/**
+ * Ticket Lock - Fair FIFO Spinlock
+ *
+ * SpinLock은 불공정(unfair):
+ *   방금 unlock한 스레드가 exchange fast path로 곧바로 재획득 가능
+ *   → 다른 대기자가 굶주림 (p99 지연 악화)
+ *
+ * Ticket Lock = 은행 번호표
+ *   1. 도착하면 번호표를 뽑음      (next_ticket_.fetch_add)
+ *   2. 내 번호가 불릴 때까지 대기   (now_serving_ == my_ticket)
+ *   3. 끝나면 다음 번호를 부름      (now_serving_ + 1)
+ *   → 도착 순서(FIFO)대로 획득, 굶주림 없음
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │  cache line 0: next_ticket_   ← 도착하는 스레드만 씀         │
+ * │  cache line 1: now_serving_   ← 보유자만 씀, 대기자는 읽기만  │
+ * │                                                              │
+ * │  분리하지 않으면: 새 도착자의 fetch_add가 now_serving_을      │
+ * │  스핀 중인 모든 대기자의 캐시라인을 무효화함                   │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * 비례 백오프 (Proportional Backoff):
+ *   내 앞에 (my_ticket - now_serving)명이 있다면
+ *   최소 그만큼의 임계 구역이 지나야 내 차례
+ *   → 거리에 비례해서 pause → 불필요한 폴링 감소
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "backoff.hpp"  // SPIN_PAUSE()
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lockfree {
+
+class TicketLock {
+public:
+    TicketLock() = default;
+
+    // Non-copyable, non-movable
+    TicketLock(const TicketLock&) = delete;
+    TicketLock& operator=(const TicketLock&) = delete;
+    TicketLock(TicketLock&&) = delete;
+    TicketLock& operator=(TicketLock&&) = delete;
+
+    void lock() {
+        // 번호표 뽑기 (순서만 정하면 되므로 relaxed)
+        const std::uint32_t my_ticket = next_ticket_.fetch_add(1, std::memory_order_relaxed);
+
+        // 스핀 예산은 pause 총 횟수로 제한
+        // (멀리 있는 대기자는 몇 번만 확인하고 바로 OS 대기로 넘어감)
+        std::uint32_t budget = spin_budget_;
+        while (true) {
+            // acquire: 이전 보유자의 release store와 동기화
+            std::uint32_t serving = now_serving_.load(std::memory_order_acquire);
+            if (serving == my_ticket) {
+                return;
+            }
+
+            // 비례 백오프: 앞에 있는 대기자 수만큼 기다림
+            // unsigned 뺄셈이므로 wrap-around에도 올바른 거리
+            std::uint32_t pauses = (my_ticket - serving) * backoff_base_;
+            if (pauses > budget) {
+                break;
+            }
+            budget -= pauses;
+            for (std::uint32_t i = 0; i < pauses; ++i) {
+                SPIN_PAUSE();
+            }
+        }
+
+        lock_slow_path(my_ticket);
+    }
+
+    bool try_lock() {
+        // 대기자가 없을 때만 (next_ticket == now_serving) 번호표를 뽑음
+        // acquire: 이전 보유자의 unlock(release)과 동기화
+        // CAS 성공 = next_ticket이 아직 serving → 그 사이 아무도 락을 잡지 않음
+        std::uint32_t serving = now_serving_.load(std::memory_order_acquire);
+        std::uint32_t expected = serving;
+        return next_ticket_.compare_exchange_strong(
+            expected,
+            serving + 1,
+            std::memory_order_acquire,
+            std::memory_order_relaxed
+        );
+    }
+
+    void unlock() {
+        // 보유자만 now_serving_을 쓰므로 load + store로 충분 (RMW 불필요)
+        std::uint32_t serving = now_serving_.load(std::memory_order_relaxed);
+        now_serving_.store(serving + 1, std::memory_order_release);
+
+        // 대기자마다 기다리는 번호가 다르므로 notify_one은 엉뚱한 스레드를 깨울 수 있음
+        // OS 대기 중인 스레드가 없으면 아무 일도 안 함 (SpinLock::unlock과 동일)
+        now_serving_.notify_all();
+    }
+
+    /**
+     * 락이 잡혀 있는지 (근사값)
+     */
+    bool is_locked() const {
+        return next_ticket_.load(std::memory_order_relaxed) !=
+               now_serving_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * 보유자를 제외한 대기자 수 (근사값)
+     *
+     * 보유자가 호출하면 "넘겨줄 상대가 있는지" 판단에 사용 가능
+     */
+    std::uint32_t waiting_count() const {
+        std::uint32_t queued = next_ticket_.load(std::memory_order_relaxed) -
+                               now_serving_.load(std::memory_order_relaxed);
+        return queued > 0 ? queued - 1 : 0;
+    }
+
+private:
+    // Slow path: now_serving_이 바뀔 때마다 깨어나서 내 차례인지 확인
+    // (SpinLock::lock_slow_path와 같은 C++20 wait/notify, futex 기반)
+    void lock_slow_path(std::uint32_t my_ticket) {
+        while (true) {
+            std::uint32_t serving = now_serving_.load(std::memory_order_acquire);
+            if (serving == my_ticket) {
+                return;
+            }
+            now_serving_.wait(serving, std::memory_order_acquire);
+        }
+    }
+
+private:
+    // 새로 도착한 스레드가 뽑을 번호
+    alignas(64) std::atomic<std::uint32_t> next_ticket_{0};
+
+    // 현재 락을 가진 번호 (32비트: futex가 직접 대기 가능)
+    alignas(64) std::atomic<std::uint32_t> now_serving_{0};
+
+    // OS 대기 전까지 쓸 수 있는 pause 총 횟수 (SpinLock의 spin_count_와 같은 역할)
+    static constexpr std::uint32_t spin_budget_ = 512;
+
+    // 대기자 한 명당 pause 횟수 (짧은 임계 구역 기준)
+    static constexpr std::uint32_t backoff_base_ = 16;
+};
+
+// ============================================
+// RAII wrapper for TicketLock
+// ============================================
+class TicketLockGuard {
+public:
+    explicit TicketLockGuard(TicketLock& lock) : lock_(lock) {
+        lock_.lock();
+    }
+
+    ~TicketLockGuard() {
+        lock_.unlock();
+    }
+
+    // Non-copyable, non-movable
+    TicketLockGuard(const TicketLockGuard&) = delete;
+    TicketLockGuard& operator=(const TicketLockGuard&) = delete;
+    TicketLockGuard(TicketLockGuard&&) = delete;
+    TicketLockGuard& operator=(TicketLockGuard&&) = delete;
+
+private:
+    TicketLock& lock_;
+};
+
+} // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,247 @@
+/**
+ * Chase-Lev Work-Stealing Deque (Chase & Lev, 2005 / Lê et al., 2013)
+ *
+ * 워커마다 하나씩 두는 로컬 작업 큐
+ *   - 주인(owner) 스레드: bottom에서 push/pop (LIFO → 캐시에 남은 최근 작업부터)
+ *   - 도둑(thief) 스레드: top에서 steal    (FIFO → 오래된, 보통 더 큰 작업을 가져감)
+ *
+ * ┌─────────────────────────────────────────────────────────────┐
+ * │   top_                                        bottom_        │
+ * │    │                                             │           │
+ * │    ▼                                             ▼           │
+ * │  [ J0 ][ J1 ][ J2 ][ J3 ][ J4 ][    ][    ][    ]            │
+ * │    ▲                           ▲                             │
+ * │  steal (CAS top_)          push / pop (주인만, 보통 CAS 없음) │
+ * └─────────────────────────────────────────────────────────────┘
+ *
+ * 주인의 push/pop은 대부분 CAS 없이 끝남
+ *   - 원소가 하나 남았을 때만 도둑과 top_ CAS로 경쟁
+ *   - 공유 MPMC 큐처럼 모든 연산이 같은 캐시라인을 두드리지 않음
+ *
+ * 메모리 순서 (Lê, Pop, Cohen, Zappa Nardelli, PPoPP 2013 - C11 검증판):
+ *   push:  slot 쓰기 → release fence → bottom_ 증가
+ *   pop:   bottom_ 감소 → seq_cst fence → top_ 읽기
+ *   steal: top_ 읽기 → seq_cst fence → bottom_ 읽기 → slot 읽기 → top_ CAS
+ *   두 seq_cst fence가 "주인의 bottom 감소"와 "도둑의 top 읽기"를 전순서로 묶음
+ *   → 마지막 원소를 둘 다 가져가는 일이 없음
+ *
+ * 크기 조정:
+ *   가득 차면 주인이 2배 배열로 복사 후 교체
+ *   도둑이 옛 배열을 읽고 있을 수 있음 → 옛 배열은 deque 소멸 시까지 보관
+ *   (크기가 2배씩 늘어나므로 보관 메모리 합 < 현재 배열 크기)
+ *
+ * 제약:
+ *   T는 trivially copyable (슬롯이 std::atomic<T>, 보통 Job* 같은 포인터)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+// Suppress MSVC warning C4324: structure was padded due to alignment specifier
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lockfree {
+
+/**
+ * Chase-Lev Work-Stealing Deque
+ *
+ * @tparam T 원소 타입 (trivially copyable)
+ */
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "WorkStealingDeque slots are std::atomic<T>: T must be trivially copyable");
+
+    /**
+     * 원형 배열 (용량 2의 거듭제곱, 인덱스는 mask로 감음)
+     *
+     * 도둑과 주인이 같은 슬롯을 동시에 읽고 쓸 수 있음 → 슬롯도 atomic (relaxed)
+     */
+    struct Buffer {
+        explicit Buffer(std::size_t cap)
+            : capacity(cap),
+              mask(cap - 1),
+              slots(std::make_unique<std::atomic<T>[]>(cap)) {}
+
+        T get(std::int64_t index) const {
+            return slots[static_cast<std::size_t>(index) & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(std::int64_t index, T value) {
+            slots[static_cast<std::size_t>(index) & mask].store(value, std::memory_order_relaxed);
+        }
+
+        const std::size_t capacity;
+        const std::size_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+    };
+
+public:
+    /**
+     * @param initial_capacity 초기 용량 (2의 거듭제곱으로 올림, 가득 차면 2배씩 확장)
+     */
+    explicit WorkStealingDeque(std::size_t initial_capacity = 1024) {
+        std::size_t capacity = std::bit_ceil(initial_capacity < 2 ? std::size_t{2} : initial_capacity);
+        buffers_.push_back(std::make_unique<Buffer>(capacity));
+        buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+    }
+
+    // Non-copyable, non-movable
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    // ========================================
+    // 주인 스레드 전용
+    // ========================================
+
+    /**
+     * bottom에 추가 (주인만 호출)
+     *
+     * 가득 차면 배열을 2배로 늘림 → 실패하지 않음
+     */
+    void push(T value) {
+        std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        std::int64_t top = top_.load(std::memory_order_acquire);
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+
+        if (bottom - top > static_cast<std::int64_t>(buffer->capacity) - 1) {
+            buffer = grow(buffer, bottom, top);
+        }
+
+        buffer->put(bottom, value);
+        // 슬롯 쓰기가 bottom_ 증가보다 먼저 보이도록 (steal의 acquire와 짝)
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * bottom에서 꺼냄 (주인만 호출, LIFO)
+     *
+     * @return 꺼낸 값, 비었거나 마지막 원소를 도둑에게 졌으면 nullopt
+     */
+    std::optional<T> pop() {
+        std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+
+        // bottom 감소를 게시한 뒤에 top을 읽음 (steal의 fence와 전순서)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = top_.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // 비어 있음 → bottom 복구
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        T value = buffer->get(bottom);
+        if (top == bottom) {
+            // 마지막 원소 → 도둑과 top CAS로 경쟁
+            bool won = top_.compare_exchange_strong(
+                top, top + 1,
+                std::memory_order_seq_cst,
+                std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            if (!won) {
+                return std::nullopt;
+            }
+        }
+        return value;
+    }
+
+    // ========================================
+    // 아무 스레드
+    // ========================================
+
+    /**
+     * top에서 훔침 (FIFO)
+     *
+     * @return 훔친 값, 비었거나 다른 도둑/주인에게 졌으면 nullopt
+     *         (경쟁에서 진 경우 다른 victim으로 넘어가는 편이 보통 나음)
+     */
+    std::optional<T> steal() {
+        std::int64_t top = top_.load(std::memory_order_acquire);
+        // top 읽기 → bottom 읽기 순서 (pop의 fence와 전순서)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+        if (top >= bottom) {
+            return std::nullopt;
+        }
+
+        // acquire: 주인이 grow에서 복사한 새 배열 내용과 짝
+        Buffer* buffer = buffer_.load(std::memory_order_acquire);
+        T value = buffer->get(top);
+        if (!top_.compare_exchange_strong(
+                top, top + 1,
+                std::memory_order_seq_cst,
+                std::memory_order_relaxed)) {
+            return std::nullopt;  // 다른 도둑 또는 주인의 마지막 pop이 가져감
+        }
+        return value;
+    }
+
+    /**
+     * 원소 수 (근사값)
+     */
+    std::size_t size() const {
+        std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        std::int64_t top = top_.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * 현재 배열 용량
+     */
+    std::size_t capacity() const {
+        return buffer_.load(std::memory_order_relaxed)->capacity;
+    }
+
+private:
+    // 주인만 호출 (push 중)
+    Buffer* grow(Buffer* old_buffer, std::int64_t bottom, std::int64_t top) {
+        auto bigger = std::make_unique<Buffer>(old_buffer->capacity * 2);
+        for (std::int64_t i = top; i < bottom; ++i) {
+            bigger->put(i, old_buffer->get(i));
+        }
+
+        Buffer* raw = bigger.get();
+        buffers_.push_back(std::move(bigger));  // 옛 배열은 소멸 시까지 보관
+        buffer_.store(raw, std::memory_order_release);
+        return raw;
+    }
+
+private:
+    // 도둑끼리 CAS하는 top_과 주인이 쓰는 bottom_은 각자 캐시라인
+    alignas(64) std::atomic<std::int64_t> top_{0};
+    alignas(64) std::atomic<std::int64_t> bottom_{0};
+
+    // 드물게 바뀜 (grow), 도둑이 자주 읽음
+    alignas(64) std::atomic<Buffer*> buffer_{nullptr};
+
+    // 지금까지 만든 모든 배열 (주인만 수정)
+    std::vector<std::unique_ptr<Buffer>> buffers_;
+};
+
+} // namespace lockfree
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -5,9 +5,23 @@
  */
 
 #include "lockfree/job_system.hpp"
+#include "lockfree/backoff.hpp"
 
 namespace lockfree {
 
+namespace {
+
+// 현재 스레드가 어느 JobSystem의 몇 번 워커인지 (워커가 아니면 owner == nullptr)
+// JobSystem이 여러 개여도 owner로 구분
+struct WorkerIdentity {
+    const JobSystem* owner = nullptr;
+    std::size_t index = 0;
+};
+
+thread_local WorkerIdentity current_worker;
+
+} // namespace
+
 // ========================================
 // 생성자
 // ========================================
@@ -15,9 +29,13 @@ namespace lockfree {
 JobSystem::JobSystem(
     std::size_t num_workers,
     [[maybe_unused]] std::size_t queue_size,
-    std::size_t pool_size
+    std::size_t pool_size,
+    SchedulerMode mode,
+    OverflowPolicy overflow
 )
-    : job_pool_(pool_size)
+    : mode_(mode)
+    , overflow_policy_(overflow)
+    , job_pool_(pool_size)
     , running_(true)
     , pending_jobs_(0)
 {
@@ -25,6 +43,13 @@ JobSystem::JobSystem(
         num_workers = std::thread::hardware_concurrency();
     }
 
+    // 워커가 시작하기 전에 deque를 모두 만들어 둠 (워커는 서로의 deque를 훔침)
+    if (mode_ == SchedulerMode::WorkStealing) {
+        for (std::size_t i = 0; i < num_workers; ++i) {
+            local_queues_.push_back(std::make_unique<LocalQueue>());
+        }
+    }
+
     for (size_t i=0; i<num_workers; ++i) {
         workers_.emplace_back(&JobSystem::worker_main, this, i);
     }
@@ -46,15 +71,72 @@ JobSystem::~JobSystem() {
     while (job_queue_.pop(job)) {
         job_pool_.destroy(job);
     }
+    while (overflow_queue_.pop(job)) {
+        job_pool_.destroy(job);
+    }
+    for (auto& local : local_queues_) {
+        while (auto left = local->deque.pop()) {
+            job_pool_.destroy(*left);
+        }
+    }
 }
 
 // ========================================
 // Job 스케줄링
 // ========================================
 
-void JobSystem::schedule(Job* job) {
+bool JobSystem::schedule(Job* job) {
     pending_jobs_.fetch_add(1, std::memory_order_relaxed);
-    job_queue_.push(job);
+
+    if (mode_ == SchedulerMode::WorkStealing) {
+        std::size_t self = current_worker_id();
+        if (self < local_queues_.size()) {
+            // 워커 안에서 만든 Job → 자기 deque (공유 큐를 건드리지 않음, 실패 없음)
+            local_queues_[self]->deque.push(job);
+            return true;
+        }
+    }
+
+    if (job_queue_.push(job)) {
+        return true;
+    }
+
+    // 큐가 가득 참: 그냥 버리면 pending_jobs_가 영원히 줄지 않음 → 정책대로 처리
+    overflow_count_.fetch_add(1, std::memory_order_relaxed);
+    return handle_overflow(job);
+}
+
+bool JobSystem::handle_overflow(Job* job) {
+    switch (overflow_policy_) {
+    case OverflowPolicy::RunInline:
+        // 호출자가 직접 실행 (생산 속도가 자연스럽게 소비 속도로 제한됨)
+        execute(job);
+        finish(job);
+        return true;
+
+    case OverflowPolicy::Spill:
+        overflow_queue_.push(job);
+        return true;
+
+    case OverflowPolicy::Reject:
+        pending_jobs_.fetch_sub(1, std::memory_order_relaxed);
+        return false;
+
+    case OverflowPolicy::HelpUntilSpace:
+        break;
+    }
+
+    while (!job_queue_.push(job)) {
+        // 대기 중인 Job을 하나 실행해서 자리를 만든다
+        Job* other = try_get_job();
+        if (other) {
+            execute(other);
+            finish(other);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    return true;
 }
 
 // ========================================
@@ -91,7 +173,9 @@ void JobSystem::wait_all() {
 // 워커 스레드
 // ========================================
 
-void JobSystem::worker_main([[maybe_unused]] std::size_t worker_id) {
+void JobSystem::worker_main(std::size_t worker_id) {
+    current_worker = WorkerIdentity{this, worker_id};
+
     while (running_.load(std::memory_order_relaxed)) {
         Job* job = try_get_job(); 
 
@@ -105,13 +189,76 @@ void JobSystem::worker_main([[maybe_unused]] std::size_t worker_id) {
 }
 
 Job* JobSystem::try_get_job() {
+    if (mode_ == SchedulerMode::WorkStealing) {
+        std::size_t self = current_worker_id();
+
+        // 1. 자기 deque (최근에 만든 Job부터 → 캐시에 남아 있음)
+        if (self < local_queues_.size()) {
+            if (auto local = local_queues_[self]->deque.pop()) {
+                return *local;
+            }
+        }
+
+        // 2. 외부 제출 Job
+        Job* job = nullptr;
+        if (job_queue_.pop(job) || try_pop_overflow(job)) {
+            return job;
+        }
+
+        // 3. 다른 워커에게서 훔치기
+        return try_steal_job(self);
+    }
+
     Job* job = nullptr;
-    if (job_queue_.pop(job)) {
+    if (job_queue_.pop(job) || try_pop_overflow(job)) {
         return job;   // 성공적으로 꺼냄
     }
     return nullptr; // 큐가 비었음
 }
 
+bool JobSystem::try_pop_overflow(Job*& job) {
+    // Spill이 아니면 보조 큐는 항상 비어 있음 → hazard pointer 비용도 건너뜀
+    return overflow_policy_ == OverflowPolicy::Spill && overflow_queue_.pop(job);
+}
+
+Job* JobSystem::try_steal_job(std::size_t self) {
+    const std::size_t count = local_queues_.size();
+    if (count == 0) {
+        return nullptr;
+    }
+
+    // 시작 victim을 무작위로 → 도둑들이 같은 워커에 몰리지 않음
+    const std::size_t start = detail::thread_random() % count;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::size_t victim = (start + i) % count;
+        if (victim == self) {
+            continue;
+        }
+        if (auto stolen = local_queues_[victim]->deque.steal()) {
+            return *stolen;
+        }
+    }
+    return nullptr;
+}
+
+bool JobSystem::has_demand() const {
+    if (mode_ == SchedulerMode::WorkStealing) {
+        std::size_t self = current_worker_id();
+        if (self < local_queues_.size()) {
+            return local_queues_[self]->deque.empty();
+        }
+    }
+    return job_queue_.empty();
+}
+
+std::size_t JobSystem::current_worker_id() const {
+    if (current_worker.owner == this) {
+        return current_worker.index;
+    }
+    // 생성 후 바뀌지 않는 크기 (workers_는 생성 중에 자람)
+    return local_queues_.size();
+}
+
 void JobSystem::execute(Job* job) {
     if (job && job->function) {
         job->function();  // 사용자가 등록한 함수 실행!
@@ -119,12 +266,12 @@ void JobSystem::execute(Job* job) {
 }
 
 void JobSystem::finish(Job* job) {
-    if (job->counter) {
-        job->counter->decrement();
-    }
-
     std::int32_t prev = job->unfinished_jobs.fetch_sub(1, std::memory_order_acq_rel);
     if (prev == 1) { // 이제 0이 됨 = 왼전히 완료
+        // counter는 자식까지 모두 끝난 뒤 한 번만 (자식이 finish(parent)로 다시 들어와도 중복 없음)
+        if (job->counter) {
+            job->counter->decrement();
+        }
         Job* parent = job->parent;
         job_pool_.destroy(job); // delete
         pending_jobs_.fetch_sub(1, std::memory_order_relaxed);
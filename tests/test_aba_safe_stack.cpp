@@ -10,6 +10,7 @@
 #include <atomic>
 #include <set>
 #include <iostream>
+#include <memory>
 #include "lockfree/aba_safe_stack.hpp"
 
 // ============================================
@@ -19,9 +20,9 @@
 TEST(ABASafeStackTest, CheckLockFree) {
     std::cout << "\n=== Lock-Free Check ===" << std::endl;
     
-    // 우리 구현은 8바이트 atomic 사용
-    std::cout << "sizeof(std::uintptr_t): " << sizeof(std::uintptr_t) << " bytes" << std::endl;
-    std::cout << "is_always_lock_free: " << std::atomic<std::uintptr_t>::is_always_lock_free << std::endl;
+    // 128비트 CAS가 있으면 16바이트, 없으면 8바이트로 패킹
+    std::cout << "sizeof(AtomicTaggedPtr): " << sizeof(lockfree::AtomicTaggedPtr<int>) << " bytes" << std::endl;
+    std::cout << "is_always_lock_free: " << lockfree::AtomicTaggedPtr<int>::is_always_lock_free << std::endl;
     std::cout << "ABASafeStack::is_lock_free(): " << lockfree::ABASafeStack<int>::is_lock_free() << std::endl;
     
     if (lockfree::ABASafeStack<int>::is_lock_free()) {
@@ -157,6 +158,175 @@ TEST(ABASafeStackTest, ABA_Stress_Test) {
     SUCCEED();
 }
 
+// ============================================
+// Part 4: 메모리 회수 (Hazard Pointer / EBR)
+// ============================================
+
+TEST(ABASafeStackTest, ConcurrentPopReclaimsAllNodes) {
+    // pop된 노드가 retire 후 결국 모두 해제되는지 (누수 없음)
+    auto token = std::make_shared<int>(0);
+    {
+        lockfree::ABASafeStack<std::shared_ptr<int>> stack;
+        constexpr int NUM_THREADS = 4;
+        constexpr int ITERATIONS = 5000;
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < NUM_THREADS; ++t) {
+            threads.emplace_back([&]() {
+                for (int i = 0; i < ITERATIONS; ++i) {
+                    stack.push(token);
+                    stack.pop();
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        stack.push(token);  // 소멸자가 남은 노드도 해제해야 함
+    }
+    EXPECT_EQ(token.use_count(), 1);
+}
+
+TEST(ABASafeStackTest, EpochReclaimerReclaimsAllNodes) {
+    // 같은 스택을 EBR 정책으로: pop마다 fence 대신 pin 한 번
+    auto token = std::make_shared<int>(0);
+    {
+        lockfree::ABASafeStack<std::shared_ptr<int>, lockfree::EpochReclaimer> stack;
+        constexpr int NUM_THREADS = 4;
+        constexpr int ITERATIONS = 5000;
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < NUM_THREADS; ++t) {
+            threads.emplace_back([&]() {
+                for (int i = 0; i < ITERATIONS; ++i) {
+                    stack.push(token);
+                    auto value = stack.pop();
+                    EXPECT_TRUE(value.has_value());
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        stack.push(token);
+    }
+    EXPECT_EQ(token.use_count(), 1);
+}
+
+TEST(ABASafeStackTest, HeapAllocatorReclaimsAllNodes) {
+    // 풀 대신 new/delete 할당자로도 같은 동작
+    auto token = std::make_shared<int>(0);
+    {
+        lockfree::ABASafeStack<std::shared_ptr<int>,
+                               lockfree::HazardPointerReclaimer,
+                               lockfree::HeapAllocator> stack;
+        for (int i = 0; i < 100; ++i) {
+            stack.push(token);
+        }
+        for (int i = 0; i < 50; ++i) {
+            EXPECT_TRUE(stack.pop().has_value());
+        }
+    }
+    EXPECT_EQ(token.use_count(), 1);
+}
+
+// ============================================
+// Part 5: 묶음 연산 (push_list / pop_all)
+// ============================================
+
+TEST(ABASafeStackTest, PushListKeepsChainOrder) {
+    lockfree::ABASafeStack<int> stack;
+    stack.push(100);
+
+    // 1 → 2 → 3 사슬을 한 번에 올림 → 1이 top
+    using Node = lockfree::ABASafeStack<int>::Node;
+    Node* first = stack.create_node(1);
+    Node* second = stack.create_node(2);
+    Node* last = stack.create_node(3);
+    first->next = second;
+    second->next = last;
+    stack.push_list(first, last);
+
+    EXPECT_EQ(stack.pop().value(), 1);
+    EXPECT_EQ(stack.pop().value(), 2);
+    EXPECT_EQ(stack.pop().value(), 3);
+    EXPECT_EQ(stack.pop().value(), 100);
+    EXPECT_FALSE(stack.pop().has_value());
+}
+
+TEST(ABASafeStackTest, PopAllTakesWholeStack) {
+    lockfree::ABASafeStack<int> stack;
+    EXPECT_TRUE(stack.pop_all().empty());
+
+    for (int i = 0; i < 5; ++i) {
+        stack.push(i);
+    }
+    {
+        auto all = stack.pop_all();
+        EXPECT_TRUE(stack.empty());
+        EXPECT_EQ(all.size(), 5u);
+
+        int expected = 4;  // top부터
+        for (int value : all) {
+            EXPECT_EQ(value, expected--);
+        }
+    }
+    // 사슬 소멸 후에도 스택은 정상 동작
+    stack.push(7);
+    EXPECT_EQ(stack.pop().value(), 7);
+}
+
+TEST(ABASafeStackTest, BatchProducersAndDrainers) {
+    lockfree::ABASafeStack<int> stack;
+    using Node = lockfree::ABASafeStack<int>::Node;
+    constexpr int NUM_PRODUCERS = 2;
+    constexpr int BATCHES = 500;
+    constexpr int BATCH_SIZE = 16;
+    std::atomic<int> producers_done{0};
+    std::atomic<long long> drained_sum{0};
+    std::atomic<int> drained_count{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < NUM_PRODUCERS; ++p) {
+        threads.emplace_back([&]() {
+            for (int b = 0; b < BATCHES; ++b) {
+                Node* first = stack.create_node(1);
+                Node* last = first;
+                for (int i = 1; i < BATCH_SIZE; ++i) {
+                    Node* node = stack.create_node(i + 1);
+                    node->next = first;
+                    first = node;
+                }
+                stack.push_list(first, last);
+            }
+            producers_done.fetch_add(1);
+        });
+    }
+    for (int c = 0; c < 2; ++c) {
+        threads.emplace_back([&]() {
+            while (true) {
+                bool done = producers_done.load() == NUM_PRODUCERS;
+                auto all = stack.pop_all();
+                for (int value : all) {
+                    drained_sum.fetch_add(value, std::memory_order_relaxed);
+                    drained_count.fetch_add(1, std::memory_order_relaxed);
+                }
+                if (done && all.empty()) {
+                    break;
+                }
+                std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    constexpr int BATCH_SUM = BATCH_SIZE * (BATCH_SIZE + 1) / 2;
+    EXPECT_EQ(drained_count.load(), NUM_PRODUCERS * BATCHES * BATCH_SIZE);
+    EXPECT_EQ(drained_sum.load(), static_cast<long long>(NUM_PRODUCERS) * BATCHES * BATCH_SUM);
+}
+
 int main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
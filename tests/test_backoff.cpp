@@ -0,0 +1,230 @@
+/**
+ * Backoff Policy Test Suite
+ *
+ * Tests for pluggable backoff policies and their use in
+ * SpinLock / MPMCQueue / MPSCQueue
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include "lockfree/backoff.hpp"
+#include "lockfree/spinlock.hpp"
+#include "lockfree/mpmc_queue.hpp"
+#include "lockfree/mpsc_queue.hpp"
+
+using namespace lockfree;
+
+// ============================================
+// Policy Behavior Tests
+// ============================================
+
+TEST(BackoffTest, ExponentialDoublesUntilCap) {
+    ExponentialBackoff<2, 16> backoff;
+    EXPECT_EQ(backoff.limit(), 2u);
+    backoff.pause();
+    EXPECT_EQ(backoff.limit(), 4u);
+    backoff.pause();
+    EXPECT_EQ(backoff.limit(), 8u);
+    backoff.pause();
+    EXPECT_EQ(backoff.limit(), 16u);
+    backoff.pause();
+    EXPECT_EQ(backoff.limit(), 16u) << "limit must stay at the cap";
+
+    backoff.reset();
+    EXPECT_EQ(backoff.limit(), 2u);
+    EXPECT_FALSE(backoff.should_block());
+}
+
+TEST(BackoffTest, JitteredGrowsLikeExponential) {
+    JitteredBackoff<1, 8> backoff;
+    for (int i = 0; i < 10; ++i) {
+        backoff.pause();
+    }
+    EXPECT_EQ(backoff.limit(), 8u);
+    EXPECT_FALSE(backoff.should_block());
+}
+
+TEST(BackoffTest, HybridBlocksAfterSpinAndYield) {
+    HybridBackoff<4, 2> backoff;
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_FALSE(backoff.should_block()) << "step " << i;
+        backoff.pause();
+    }
+    EXPECT_TRUE(backoff.should_block());
+
+    backoff.reset();
+    EXPECT_FALSE(backoff.should_block());
+}
+
+TEST(BackoffTest, NonBlockingPoliciesNeverBlock) {
+    NoBackoff none;
+    ConstantBackoff<4> constant;
+    for (int i = 0; i < 100; ++i) {
+        none.pause();
+        constant.pause();
+    }
+    EXPECT_FALSE(none.should_block());
+    EXPECT_FALSE(constant.should_block());
+}
+
+namespace {
+
+// 매 라운드 spins번 스핀 후 획득한 것처럼 추정치 갱신
+void simulate_acquisitions(AdaptiveSpinState& state, std::uint32_t spins, int rounds) {
+    for (int round = 0; round < rounds; ++round) {
+        AdaptiveBackoff<10, 100> backoff(state);
+        for (std::uint32_t i = 0; i < spins; ++i) {
+            ASSERT_FALSE(backoff.should_block()) << "spins exceed budget " << backoff.limit();
+            backoff.pause();
+        }
+        backoff.on_acquired();
+    }
+}
+
+} // namespace
+
+TEST(BackoffTest, AdaptiveLearnsSpinsToAcquire) {
+    AdaptiveSpinState state;
+    EXPECT_EQ(state.spins(), 0u);
+
+    // 8번 만에 얻음 → 추정치가 8로 수렴
+    simulate_acquisitions(state, 8, 64);
+    EXPECT_GE(state.spins(), 7u);
+    EXPECT_LE(state.spins(), 8u);
+
+    // 예산이 2 * 추정치 + MinSpins로 늘었으므로 20번 스핀도 성공 → 20으로 수렴
+    simulate_acquisitions(state, 20, 64);
+    EXPECT_GE(state.spins(), 19u);
+    EXPECT_LE(state.spins(), 20u);
+
+    // 예산 = 2 * 추정치 + MinSpins (MaxSpins로 상한)
+    AdaptiveBackoff<10, 100> next(state);
+    EXPECT_EQ(next.limit(), 2 * state.spins() + 10);
+    AdaptiveBackoff<10, 30> capped(state);
+    EXPECT_EQ(capped.limit(), 30u);
+}
+
+TEST(BackoffTest, AdaptiveDecaysWhenSpinningFails) {
+    AdaptiveSpinState state;
+    state.scaled_estimate.store(50 * 8);
+
+    // 예산을 다 쓰고도 못 얻음 (오래 잡히는 락) → 추정치 감소
+    for (int round = 0; round < 64; ++round) {
+        AdaptiveBackoff<4, 100> backoff(state);
+        while (!backoff.should_block()) {
+            backoff.pause();
+        }
+        backoff.on_acquired();
+    }
+    EXPECT_EQ(state.spins(), 0u);
+
+    // 최소 예산만 남음 → 거의 곧바로 OS 대기
+    AdaptiveBackoff<4, 100> backoff(state);
+    EXPECT_EQ(backoff.limit(), 4u);
+}
+
+// ============================================
+// SpinLock with Policies
+// ============================================
+
+template <typename Lock>
+long long run_locked_increments(int num_threads, int iterations) {
+    Lock lock;
+    long long counter = 0;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; ++i) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < iterations; ++j) {
+                SpinLockGuard guard(lock);
+                ++counter;
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    return counter;
+}
+
+TEST(BackoffSpinLockTest, DefaultSpinLockIsHybrid) {
+    static_assert(std::is_same_v<SpinLock::backoff_type, HybridBackoff<32, 0>>);
+    EXPECT_EQ(run_locked_increments<SpinLock>(4, 10000), 40000);
+}
+
+TEST(BackoffSpinLockTest, ExponentialBackoffLock) {
+    EXPECT_EQ((run_locked_increments<BasicSpinLock<ExponentialBackoff<1, 64>>>(4, 10000)), 40000);
+}
+
+TEST(BackoffSpinLockTest, JitteredBackoffLock) {
+    EXPECT_EQ((run_locked_increments<BasicSpinLock<JitteredBackoff<1, 64>>>(4, 10000)), 40000);
+}
+
+TEST(BackoffSpinLockTest, AdaptiveSpinLock) {
+#ifndef LOCKFREE_LOCK_PROFILING
+    static_assert(sizeof(SpinLock) == 64, "stateless policy adds no storage");
+    static_assert(sizeof(AdaptiveSpinLock) == 64, "adaptive state shares the lock's cache line");
+#endif
+    EXPECT_EQ(run_locked_increments<AdaptiveSpinLock>(8, 10000), 80000);
+}
+
+TEST(BackoffSpinLockTest, SpinYieldBlockLock) {
+    EXPECT_EQ((run_locked_increments<BasicSpinLock<HybridBackoff<16, 4>>>(8, 10000)), 80000);
+}
+
+// ============================================
+// Queues with Policies
+// ============================================
+
+template <typename Queue>
+void run_mpmc_sum(int producers, int consumers, int per_producer) {
+    Queue queue;
+    std::atomic<long long> sum{0};
+    std::atomic<int> consumed{0};
+    const int total = producers * per_producer;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p]() {
+            for (int i = 0; i < per_producer; ++i) {
+                while (!queue.push(p * per_producer + i + 1)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&]() {
+            int value;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (queue.pop(value)) {
+                    sum.fetch_add(value, std::memory_order_relaxed);
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    long long expected = static_cast<long long>(total) * (total + 1) / 2;
+    EXPECT_EQ(sum.load(), expected);
+}
+
+TEST(BackoffQueueTest, MPMCWithExponentialBackoff) {
+    run_mpmc_sum<MPMCQueue<int, 1024, ExponentialBackoff<1, 128>>>(4, 4, 20000);
+}
+
+TEST(BackoffQueueTest, MPMCWithJitteredBackoff) {
+    run_mpmc_sum<MPMCQueue<int, 1024, JitteredBackoff<1, 128>>>(4, 4, 20000);
+}
+
+TEST(BackoffQueueTest, MPSCWithHybridBackoff) {
+    // 큐는 should_block()을 무시하고 계속 yield
+    run_mpmc_sum<MPSCQueue<int, 1024, HybridBackoff<8, 8>>>(4, 1, 20000);
+}
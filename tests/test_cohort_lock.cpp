@@ -0,0 +1,160 @@
+/**
+ * Cohort Lock Test Suite
+ *
+ * Tests for NUMA topology detection and the hierarchical cohort lock
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include "lockfree/numa_topology.hpp"
+#include "lockfree/cohort_lock.hpp"
+
+// ============================================
+// Topology Tests
+// ============================================
+
+TEST(NumaTopologyTest, ParseCpuList) {
+    using lockfree::detail::parse_cpu_list;
+
+    EXPECT_EQ(parse_cpu_list("0"), (std::vector<std::uint32_t>{0}));
+    EXPECT_EQ(parse_cpu_list("0-3"), (std::vector<std::uint32_t>{0, 1, 2, 3}));
+    EXPECT_EQ(parse_cpu_list("0-1,8,10-11\n"), (std::vector<std::uint32_t>{0, 1, 8, 10, 11}));
+    EXPECT_TRUE(parse_cpu_list("").empty());
+    EXPECT_TRUE(parse_cpu_list("x-y").empty());
+    EXPECT_TRUE(parse_cpu_list("5-2").empty());
+}
+
+TEST(NumaTopologyTest, DetectsAtLeastOneNode) {
+    const auto& topology = lockfree::NumaTopology::instance();
+    EXPECT_GE(topology.node_count(), 1u);
+    EXPECT_LT(topology.current_node(), topology.node_count());
+}
+
+// ============================================
+// Basic Functionality Tests
+// ============================================
+
+TEST(CohortLockTest, LockUnlock) {
+    lockfree::CohortLock lock;
+    EXPECT_EQ(lock.node_count(), lockfree::NumaTopology::instance().node_count());
+    EXPECT_EQ(lock.batch_limit(), lockfree::CohortLock::DEFAULT_BATCH_LIMIT);
+
+    lock.lock();
+    lock.unlock();
+    lock.lock();
+    lock.unlock();
+}
+
+TEST(CohortLockTest, TryLock) {
+    lockfree::CohortLock lock;
+    EXPECT_TRUE(lock.try_lock());
+
+    std::thread other([&]() {
+        EXPECT_FALSE(lock.try_lock());
+    });
+    other.join();
+
+    lock.unlock();
+    EXPECT_TRUE(lock.try_lock());
+    lock.unlock();
+}
+
+TEST(CohortLockTest, TryLockFailsWhileOtherNodeHoldsGlobal) {
+    // 단일 노드 머신에서도 노드 간 동작을 확인하도록 노드 수 지정
+    lockfree::CohortLock lock(2, 4);
+    lock.lock(1);
+
+    std::thread other([&]() {
+        // 이 스레드의 노드(0)의 로컬 락은 비었지만 글로벌 락은 node 1이 보유
+        EXPECT_FALSE(lock.try_lock());
+    });
+    other.join();
+
+    lock.unlock();
+}
+
+TEST(CohortLockTest, WithStdLockGuard) {
+    lockfree::CohortLock lock;
+    {
+        std::lock_guard<lockfree::CohortLock> guard(lock);
+    }
+    EXPECT_TRUE(lock.try_lock());
+    lock.unlock();
+}
+
+// ============================================
+// Multithreaded Tests
+// ============================================
+
+namespace {
+
+// 스레드마다 노드를 강제로 배정 (i % node_count)
+void run_cohort_counter(std::uint32_t node_count, std::uint32_t batch_limit,
+                        int num_threads, int iterations) {
+    lockfree::CohortLock lock(node_count, batch_limit);
+    long long counter = 0;
+    std::atomic<int> inside{0};
+    std::atomic<bool> overlap{false};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; ++i) {
+        threads.emplace_back([&, i]() {
+            const auto node = static_cast<std::uint32_t>(i) % node_count;
+            for (int j = 0; j < iterations; ++j) {
+                lock.lock(node);
+                if (inside.fetch_add(1, std::memory_order_relaxed) != 0) {
+                    overlap.store(true, std::memory_order_relaxed);
+                }
+                ++counter;
+                inside.fetch_sub(1, std::memory_order_relaxed);
+                lock.unlock();
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_FALSE(overlap.load());
+    EXPECT_EQ(counter, static_cast<long long>(num_threads) * iterations);
+}
+
+} // namespace
+
+TEST(CohortLockTest, DetectedTopologyCounter) {
+    lockfree::CohortLock lock;
+    long long counter = 0;
+    constexpr int NUM_THREADS = 4;
+    constexpr int ITERATIONS = 10000;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < ITERATIONS; ++j) {
+                lockfree::CohortLockGuard guard(lock);
+                ++counter;
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(counter, NUM_THREADS * ITERATIONS);
+}
+
+TEST(CohortLockTest, SimulatedTwoNodes) {
+    run_cohort_counter(2, 16, 4, 10000);
+}
+
+TEST(CohortLockTest, SimulatedFourNodesBatchOne) {
+    // batch_limit = 1: 매번 글로벌 락까지 해제 (로컬 handoff 없음)
+    run_cohort_counter(4, 1, 8, 5000);
+}
+
+TEST(CohortLockTest, StressTest) {
+    run_cohort_counter(2, lockfree::CohortLock::DEFAULT_BATCH_LIMIT, 8, 20000);
+}
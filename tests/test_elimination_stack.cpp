@@ -0,0 +1,145 @@
+/**
+ * Elimination Backoff Stack Test Suite
+ *
+ * Tests for the elimination array and the stack built on ABASafeStack
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <iostream>
+#include <string>
+#include "lockfree/elimination_stack.hpp"
+
+namespace {
+
+struct Item {
+    int value;
+};
+
+} // namespace
+
+// ============================================
+// EliminationArray
+// ============================================
+
+TEST(EliminationArrayTest, OfferWithoutPartnerTimesOut) {
+    lockfree::EliminationArray<Item, 4> array;
+    Item item{1};
+    EXPECT_FALSE(array.offer(&item, 16));
+    EXPECT_EQ(array.take(16), nullptr);
+    EXPECT_EQ(array.elimination_count(), 0u);
+}
+
+TEST(EliminationArrayTest, WidthAdaptsWithinBounds) {
+    lockfree::EliminationArray<Item, 4> array;
+    EXPECT_EQ(array.width(), 1u);
+
+    // 시간 초과만 반복 → 폭은 1 밑으로 내려가지 않음
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(array.take(1), nullptr);
+    }
+    EXPECT_EQ(array.width(), 1u);
+}
+
+TEST(EliminationArrayTest, PushHandsNodeToPop) {
+    lockfree::EliminationArray<Item, 1> array;
+    Item item{42};
+    std::atomic<bool> offered{false};
+    Item* received = nullptr;
+
+    std::thread pusher([&]() {
+        while (!array.offer(&item, 1024)) {
+            std::this_thread::yield();
+        }
+        offered.store(true);
+    });
+    std::thread popper([&]() {
+        while ((received = array.take(1024)) == nullptr) {
+            std::this_thread::yield();
+        }
+    });
+    pusher.join();
+    popper.join();
+
+    EXPECT_TRUE(offered.load());
+    ASSERT_EQ(received, &item);
+    EXPECT_EQ(received->value, 42);
+    EXPECT_EQ(array.elimination_count(), 1u);
+}
+
+// ============================================
+// EliminationBackoffStack
+// ============================================
+
+TEST(EliminationStackTest, IsLockFree) {
+    EXPECT_TRUE(lockfree::EliminationBackoffStack<int>::is_lock_free());
+}
+
+TEST(EliminationStackTest, LIFOOrderWithoutContention) {
+    lockfree::EliminationBackoffStack<int> stack;
+    for (int i = 0; i < 10; ++i) {
+        stack.push(i);
+    }
+    for (int i = 9; i >= 0; --i) {
+        EXPECT_EQ(stack.pop().value(), i);
+    }
+    EXPECT_FALSE(stack.pop().has_value());
+    EXPECT_TRUE(stack.empty());
+    EXPECT_EQ(stack.elimination_count(), 0u);
+}
+
+TEST(EliminationStackTest, MoveOnlyType) {
+    lockfree::EliminationBackoffStack<std::unique_ptr<std::string>> stack;
+    stack.push(std::make_unique<std::string>("eliminated"));
+    auto value = stack.pop();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(**value, "eliminated");
+}
+
+TEST(EliminationStackTest, EpochReclaimer) {
+    lockfree::EliminationBackoffStack<int, lockfree::EpochReclaimer> stack;
+    for (int i = 0; i < 1000; ++i) {
+        stack.push(i);
+    }
+    int count = 0;
+    while (stack.pop()) {
+        ++count;
+    }
+    EXPECT_EQ(count, 1000);
+}
+
+TEST(EliminationStackTest, ConcurrentPushPopConservesValues) {
+    lockfree::EliminationBackoffStack<int> stack;
+    constexpr int NUM_THREADS = 8;
+    constexpr int ITERATIONS = 20000;
+    std::atomic<long long> pushed{0};
+    std::atomic<long long> popped{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < ITERATIONS; ++i) {
+                int value = t * ITERATIONS + i + 1;
+                stack.push(value);
+                pushed.fetch_add(value, std::memory_order_relaxed);
+                if (auto v = stack.pop()) {
+                    popped.fetch_add(*v, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    while (auto v = stack.pop()) {
+        popped.fetch_add(*v, std::memory_order_relaxed);
+    }
+
+    std::cout << "eliminations: " << stack.elimination_count()
+              << ", final width: " << stack.elimination_width() << std::endl;
+    EXPECT_EQ(pushed.load(), popped.load());
+    EXPECT_LE(stack.elimination_width(), 16u);
+}
@@ -0,0 +1,247 @@
+/**
+ * Epoch-Based Reclamation Test Suite
+ *
+ * Tests for EpochDomain pinning, epoch advance and batched limbo reclamation
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include "lockfree/epoch.hpp"
+#include "lockfree/memory_pool.hpp"
+
+using lockfree::EpochDomain;
+using lockfree::EpochGuard;
+using lockfree::EpochNode;
+
+namespace {
+
+struct TrackedNode : EpochNode {
+    explicit TrackedNode(int v) : value(v) {}
+    int value;
+    std::atomic<bool> reclaimed{false};
+};
+
+/**
+ * 해제하지 않고 "해제됨" 표시만 하는 reclaimer (test_hazard_pointer와 동일)
+ */
+struct Graveyard {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<TrackedNode>> nodes;
+    std::atomic<int> count{0};
+
+    static void reclaim(EpochNode* const* nodes, std::size_t count, void* context) {
+        auto* self = static_cast<Graveyard*>(context);
+        std::lock_guard<std::mutex> guard(self->mutex);
+        for (std::size_t i = 0; i < count; ++i) {
+            auto* tracked = static_cast<TrackedNode*>(nodes[i]);
+            tracked->reclaimed.store(true, std::memory_order_relaxed);
+            self->nodes.emplace_back(tracked);
+        }
+        self->count.fetch_add(static_cast<int>(count), std::memory_order_relaxed);
+    }
+};
+
+} // namespace
+
+// ============================================
+// Basic Functionality Tests
+// ============================================
+
+TEST(EpochTest, NodeReclaimedAfterTwoAdvances) {
+    Graveyard graveyard;
+    EpochDomain domain(&Graveyard::reclaim, &graveyard);
+
+    auto* node = new TrackedNode(1);
+    domain.retire(node);
+
+    EXPECT_TRUE(domain.try_advance());
+    EXPECT_FALSE(node->reclaimed.load()) << "one advance is not a grace period";
+    EXPECT_TRUE(domain.try_advance());
+    EXPECT_TRUE(node->reclaimed.load());
+    EXPECT_EQ(domain.retired_count(), 0u);
+    EXPECT_EQ(domain.epoch(), 2u);
+}
+
+TEST(EpochTest, PinnedReaderBlocksAdvance) {
+    Graveyard graveyard;
+    EpochDomain domain(&Graveyard::reclaim, &graveyard);
+
+    auto* node = new TrackedNode(1);
+    std::atomic<TrackedNode*> src{node};
+
+    {
+        EpochGuard guard(domain);
+        EXPECT_EQ(guard.protect(src), node);
+
+        src.store(nullptr);  // unlink
+        domain.retire(node);
+
+        // 리더가 현재 epoch에 있으므로 한 번은 전진 가능, 그 다음은 막힘
+        EXPECT_TRUE(domain.try_advance());
+        EXPECT_FALSE(domain.try_advance());
+        EXPECT_FALSE(domain.try_advance());
+        EXPECT_FALSE(node->reclaimed.load()) << "node reclaimed under a live guard";
+    }
+
+    EXPECT_TRUE(domain.try_advance());
+    EXPECT_TRUE(node->reclaimed.load());
+}
+
+TEST(EpochTest, IdleRecordsDoNotBlockAdvance) {
+    Graveyard graveyard;
+    EpochDomain domain(&Graveyard::reclaim, &graveyard);
+
+    { EpochGuard guard(domain); }
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(domain.try_advance());
+    }
+    EXPECT_EQ(domain.epoch(), 5u);
+}
+
+TEST(EpochTest, RecordsAreReused) {
+    Graveyard graveyard;
+    EpochDomain domain(&Graveyard::reclaim, &graveyard);
+
+    for (int i = 0; i < 100; ++i) {
+        EpochGuard guard(domain);
+    }
+    EXPECT_EQ(domain.record_count(), 1u);
+
+    {
+        EpochGuard a(domain);
+        EpochGuard b(domain);  // 중첩 guard는 record를 따로 차지
+        EXPECT_EQ(domain.record_count(), 2u);
+    }
+}
+
+TEST(EpochTest, RetireAdvancesAutomatically) {
+    Graveyard graveyard;
+    EpochDomain domain(&Graveyard::reclaim, &graveyard);
+
+    // 임계값마다 전진 시도 → 리더가 없으면 오래된 limbo는 계속 비워짐
+    constexpr int COUNT = 10 * static_cast<int>(EpochDomain::ADVANCE_THRESHOLD);
+    for (int i = 0; i < COUNT; ++i) {
+        domain.retire(new TrackedNode(i));
+    }
+    EXPECT_GE(domain.epoch(), 9u);
+    EXPECT_LE(domain.retired_count(), 3 * EpochDomain::ADVANCE_THRESHOLD);
+    EXPECT_EQ(graveyard.count.load() + static_cast<int>(domain.retired_count()), COUNT);
+}
+
+TEST(EpochTest, DestructorReclaimsEverything) {
+    Graveyard graveyard;
+    {
+        EpochDomain domain(&Graveyard::reclaim, &graveyard);
+        for (int i = 0; i < 10; ++i) {
+            domain.retire(new TrackedNode(i));
+        }
+    }
+    EXPECT_EQ(graveyard.count.load(), 10);
+}
+
+// ============================================
+// MemoryPool 연동: limbo를 묶음으로 풀에 반환
+// ============================================
+
+namespace {
+
+struct PooledNode : EpochNode {
+    explicit PooledNode(int v) : value(v) {}
+    int value;
+};
+
+struct PoolReturn {
+    lockfree::MemoryPool<PooledNode> pool{256};
+    int batches = 0;
+
+    static void reclaim(EpochNode* const* nodes, std::size_t count, void* context) {
+        auto* self = static_cast<PoolReturn*>(context);
+        self->pool.destroy_bulk(nodes, count);
+        ++self->batches;
+    }
+};
+
+} // namespace
+
+TEST(EpochTest, LimboReturnsToPoolInBatches) {
+    PoolReturn target;
+    EpochDomain domain(&PoolReturn::reclaim, &target);
+
+    constexpr int COUNT = 100;
+    for (int i = 0; i < COUNT; ++i) {
+        domain.retire(target.pool.construct(i));
+    }
+    EXPECT_EQ(target.pool.allocated_count(), static_cast<std::size_t>(COUNT));
+
+    domain.reclaim_all();
+    EXPECT_EQ(target.pool.allocated_count(), 0u);
+    EXPECT_LE(target.batches, 3) << "batches of up to 64, not one call per node";
+
+    // 반환된 블록은 다시 할당됨
+    PooledNode* again = target.pool.construct(7);
+    ASSERT_NE(again, nullptr);
+    EXPECT_EQ(again->value, 7);
+    target.pool.destroy(again);
+}
+
+// ============================================
+// Multithreaded Tests
+// ============================================
+
+TEST(EpochTest, ReadersNeverSeeReclaimedNodes) {
+    Graveyard graveyard;
+    EpochDomain domain(&Graveyard::reclaim, &graveyard);
+    std::atomic<TrackedNode*> shared{new TrackedNode(0)};
+
+    constexpr int NUM_READERS = 4;
+    constexpr int NUM_UPDATES = 20000;
+    std::atomic<bool> stop{false};
+    std::atomic<bool> saw_reclaimed{false};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < NUM_READERS; ++i) {
+        readers.emplace_back([&]() {
+            while (!stop.load(std::memory_order_relaxed)) {
+                EpochGuard guard(domain);
+                // guard 하나로 여러 번 읽어도 모두 보호됨
+                for (int j = 0; j < 4; ++j) {
+                    TrackedNode* node = guard.protect(shared);
+                    if (node->reclaimed.load(std::memory_order_relaxed)) {
+                        saw_reclaimed.store(true, std::memory_order_relaxed);
+                    }
+                }
+            }
+        });
+    }
+
+    std::thread writer([&]() {
+        for (int i = 1; i <= NUM_UPDATES; ++i) {
+            TrackedNode* old = shared.exchange(new TrackedNode(i));
+            domain.retire(old);
+            if (i % 256 == 0) {
+                // pin한 채 선점된 리더가 있으면 전진 불가 → 리더에게 차례를 줌
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    writer.join();
+    stop.store(true);
+    for (auto& t : readers) {
+        t.join();
+    }
+
+    EXPECT_FALSE(saw_reclaimed.load());
+
+    // 리더가 모두 빠졌으면 두 번 전진으로 limbo가 전부 비워짐
+    EXPECT_TRUE(domain.try_advance());
+    EXPECT_TRUE(domain.try_advance());
+    EXPECT_EQ(domain.retired_count(), 0u);
+    EXPECT_EQ(graveyard.count.load(), NUM_UPDATES);
+
+    domain.retire(shared.exchange(nullptr));
+}
@@ -0,0 +1,188 @@
+/**
+ * Flat Combining Test Suite
+ *
+ * Tests for FlatCombiner wrapping sequential data structures
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "lockfree/flat_combining.hpp"
+
+using lockfree::FlatCombiner;
+
+// ============================================
+// Basic Functionality Tests
+// ============================================
+
+TEST(FlatCombinerTest, ApplyReturnsResult) {
+    FlatCombiner<std::vector<int>> vec;
+    vec.apply([](std::vector<int>& v) { v.push_back(1); });
+    vec.apply([](std::vector<int>& v) { v.push_back(2); });
+
+    std::size_t size = vec.apply([](std::vector<int>& v) { return v.size(); });
+    EXPECT_EQ(size, 2u);
+
+    int back = vec.apply([](const std::vector<int>& v) { return v.back(); });
+    EXPECT_EQ(back, 2);
+}
+
+TEST(FlatCombinerTest, ConstructorForwardsArguments) {
+    FlatCombiner<std::vector<int>> vec(5, 7);
+    EXPECT_EQ(vec.apply([](std::vector<int>& v) { return v.size(); }), 5u);
+    EXPECT_EQ(vec.apply([](std::vector<int>& v) { return v[4]; }), 7);
+}
+
+TEST(FlatCombinerTest, LvalueCallable) {
+    FlatCombiner<int> value(10);
+    auto add_one = [](int& v) { return ++v; };
+    EXPECT_EQ(value.apply(add_one), 11);
+    EXPECT_EQ(value.apply(add_one), 12);
+}
+
+TEST(FlatCombinerTest, ApplyReturnsReference) {
+    // std::optional<int&>은 만들 수 없음 → 참조 결과는 포인터로 보관 후 되돌려줌
+    FlatCombiner<std::vector<int>> vec(3, 0);
+    int& first = vec.apply([](std::vector<int>& v) -> int& { return v.front(); });
+    first = 42;
+    EXPECT_EQ(vec.apply([](std::vector<int>& v) { return v[0]; }), 42);
+
+    const int& last = vec.apply([](const std::vector<int>& v) -> const int& { return v.back(); });
+    EXPECT_EQ(&last, vec.apply([](std::vector<int>& v) { return &v.back(); }));
+
+    static_assert(std::is_same_v<decltype(vec.apply([](std::vector<int>& v) -> int& { return v[1]; })), int&>);
+}
+
+TEST(FlatCombinerTest, ApplyReturnsRvalueReference) {
+    // T&&도 포인터로 보관 → 호출자가 대상에서 직접 move
+    FlatCombiner<std::vector<std::string>> names(1, std::string(64, 'x'));
+    std::string taken = names.apply([](std::vector<std::string>& v) -> std::string&& {
+        return std::move(v.front());
+    });
+    EXPECT_EQ(taken, std::string(64, 'x'));
+    EXPECT_EQ(names.apply([](std::vector<std::string>& v) { return v.size(); }), 1u);
+
+    static_assert(std::is_same_v<decltype(names.apply([](std::vector<std::string>& v) -> std::string&& {
+                      return std::move(v[0]);
+                  })),
+                  std::string&&>);
+}
+
+TEST(FlatCombinerTest, ExceptionPropagatesToCaller) {
+    FlatCombiner<std::map<int, int>> book;
+    EXPECT_THROW(
+        book.apply([](std::map<int, int>& m) { return m.at(42); }),
+        std::out_of_range);
+
+    // 예외 뒤에도 정상 동작 (슬롯/락이 풀려 있어야 함)
+    book.apply([](std::map<int, int>& m) { m[42] = 1; });
+    EXPECT_EQ(book.apply([](std::map<int, int>& m) { return m.at(42); }), 1);
+}
+
+TEST(FlatCombinerTest, StatisticsCountOperations) {
+    FlatCombiner<int> value;
+    for (int i = 0; i < 10; ++i) {
+        value.apply([](int& v) { ++v; });
+    }
+    EXPECT_EQ(value.combined_operations(), 10u);
+    EXPECT_GE(value.combine_count(), 1u);
+    EXPECT_LE(value.combine_count(), 10u);
+}
+
+// ============================================
+// Multithreaded Tests
+// ============================================
+
+TEST(FlatCombinerTest, ConcurrentCounter) {
+    FlatCombiner<long long> counter;
+    constexpr int NUM_THREADS = 8;
+    constexpr int ITERATIONS = 10000;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < ITERATIONS; ++j) {
+                counter.apply([](long long& c) { ++c; });
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(counter.apply([](long long& c) { return c; }), NUM_THREADS * ITERATIONS);
+    EXPECT_EQ(counter.combined_operations(), NUM_THREADS * ITERATIONS + 1u);
+}
+
+TEST(FlatCombinerTest, ConcurrentDequeProducersConsumers) {
+    FlatCombiner<std::deque<int>> queue;
+    constexpr int NUM_PRODUCERS = 4;
+    constexpr int NUM_CONSUMERS = 4;
+    constexpr int PER_PRODUCER = 10000;
+    constexpr int TOTAL = NUM_PRODUCERS * PER_PRODUCER;
+
+    std::atomic<long long> sum{0};
+    std::atomic<int> consumed{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < NUM_PRODUCERS; ++p) {
+        threads.emplace_back([&, p]() {
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                int value = p * PER_PRODUCER + i + 1;
+                queue.apply([value](std::deque<int>& q) { q.push_back(value); });
+            }
+        });
+    }
+    for (int c = 0; c < NUM_CONSUMERS; ++c) {
+        threads.emplace_back([&]() {
+            while (consumed.load(std::memory_order_relaxed) < TOTAL) {
+                int value = queue.apply([](std::deque<int>& q) {
+                    if (q.empty()) {
+                        return 0;
+                    }
+                    int front = q.front();
+                    q.pop_front();
+                    return front;
+                });
+                if (value != 0) {
+                    sum.fetch_add(value, std::memory_order_relaxed);
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    long long expected = static_cast<long long>(TOTAL) * (TOTAL + 1) / 2;
+    EXPECT_EQ(sum.load(), expected);
+}
+
+TEST(FlatCombinerTest, MoreThreadsThanSlots) {
+    FlatCombiner<long long, 4> counter;
+    constexpr int NUM_THREADS = 16;
+    constexpr int ITERATIONS = 2000;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < ITERATIONS; ++j) {
+                counter.apply([](long long& c) { ++c; });
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(counter.apply([](long long& c) { return c; }), NUM_THREADS * ITERATIONS);
+}
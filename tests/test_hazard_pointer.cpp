@@ -0,0 +1,219 @@
+/**
+ * Hazard Pointer Test Suite
+ *
+ * Tests for HazardPointerDomain protection, retire and amortized scan
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include "lockfree/hazard_pointer.hpp"
+
+using lockfree::HazardPointer;
+using lockfree::HazardPointerDomain;
+using lockfree::HazardPointerNode;
+
+namespace {
+
+struct TrackedNode : HazardPointerNode {
+    explicit TrackedNode(int v) : value(v) {}
+    int value;
+    std::atomic<bool> reclaimed{false};
+};
+
+/**
+ * 해제하지 않고 "해제됨" 표시만 하는 reclaimer
+ *
+ * 보호 중인 노드가 reclaim되면 reader가 표시를 보고 검출할 수 있음
+ * (실제 메모리는 테스트 끝에 한꺼번에 해제)
+ */
+struct Graveyard {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<TrackedNode>> nodes;
+    std::atomic<int> count{0};
+    std::atomic<int> batches{0};
+
+    static void reclaim(HazardPointerNode* const* nodes, std::size_t count, void* context) {
+        auto* self = static_cast<Graveyard*>(context);
+        std::lock_guard<std::mutex> guard(self->mutex);
+        for (std::size_t i = 0; i < count; ++i) {
+            auto* tracked = static_cast<TrackedNode*>(nodes[i]);
+            tracked->reclaimed.store(true, std::memory_order_relaxed);
+            self->nodes.emplace_back(tracked);
+        }
+        self->count.fetch_add(static_cast<int>(count), std::memory_order_relaxed);
+        self->batches.fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+} // namespace
+
+// ============================================
+// Basic Functionality Tests
+// ============================================
+
+TEST(HazardPointerTest, ProtectedNodeSurvivesScan) {
+    Graveyard graveyard;
+    HazardPointerDomain domain(&Graveyard::reclaim, &graveyard);
+
+    auto* node = new TrackedNode(1);
+    std::atomic<TrackedNode*> src{node};
+
+    {
+        HazardPointer hp(domain);
+        EXPECT_EQ(hp.protect(src), node);
+
+        src.store(nullptr);  // unlink
+        domain.retire(node);
+        domain.scan();
+        EXPECT_FALSE(node->reclaimed.load()) << "protected node must not be reclaimed";
+        EXPECT_EQ(domain.retired_count(), 1u);
+
+        hp.reset_protection();
+        domain.scan();
+        EXPECT_TRUE(node->reclaimed.load());
+        EXPECT_EQ(domain.retired_count(), 0u);
+    }
+}
+
+TEST(HazardPointerTest, ReleasedHazardPointerDoesNotProtect) {
+    Graveyard graveyard;
+    HazardPointerDomain domain(&Graveyard::reclaim, &graveyard);
+
+    auto* node = new TrackedNode(1);
+    std::atomic<TrackedNode*> src{node};
+    {
+        HazardPointer hp(domain);
+        hp.protect(src);
+    }  // 소멸 = 보호 해제
+
+    src.store(nullptr);
+    domain.retire(node);
+    domain.scan();
+    EXPECT_TRUE(node->reclaimed.load());
+}
+
+TEST(HazardPointerTest, RecordsAreReused) {
+    Graveyard graveyard;
+    HazardPointerDomain domain(&Graveyard::reclaim, &graveyard);
+
+    for (int i = 0; i < 100; ++i) {
+        HazardPointer hp(domain);
+    }
+    EXPECT_EQ(domain.record_count(), 1u);
+
+    {
+        HazardPointer a(domain);
+        HazardPointer b(domain);
+        EXPECT_EQ(domain.record_count(), 2u);
+    }
+    {
+        HazardPointer a(domain);
+        HazardPointer b(domain);
+        EXPECT_EQ(domain.record_count(), 2u);
+    }
+}
+
+TEST(HazardPointerTest, ScanIsAmortized) {
+    Graveyard graveyard;
+    HazardPointerDomain domain(&Graveyard::reclaim, &graveyard);
+
+    // 임계값 전까지는 retire만 하고 scan하지 않음
+    for (std::size_t i = 0; i + 1 < HazardPointerDomain::SCAN_THRESHOLD; ++i) {
+        domain.retire(new TrackedNode(static_cast<int>(i)));
+    }
+    EXPECT_EQ(graveyard.count.load(), 0);
+
+    // 임계값 도달 → scan → 보호되지 않은 노드 모두 해제
+    domain.retire(new TrackedNode(-1));
+    EXPECT_EQ(graveyard.count.load(), static_cast<int>(HazardPointerDomain::SCAN_THRESHOLD));
+    EXPECT_EQ(graveyard.batches.load(), 1) << "one scan reclaims in one batch";
+    EXPECT_EQ(domain.retired_count(), 0u);
+}
+
+TEST(HazardPointerTest, DestructorReclaimsEverything) {
+    Graveyard graveyard;
+    {
+        HazardPointerDomain domain(&Graveyard::reclaim, &graveyard);
+        for (int i = 0; i < 10; ++i) {
+            domain.retire(new TrackedNode(i));
+        }
+    }
+    EXPECT_EQ(graveyard.count.load(), 10);
+}
+
+TEST(HazardPointerTest, ProtectWithTaggedValue) {
+    Graveyard graveyard;
+    HazardPointerDomain domain(&Graveyard::reclaim, &graveyard);
+
+    auto* node = new TrackedNode(7);
+    // 하위 비트에 태그를 섞은 값 (노드는 최소 8바이트 정렬)
+    std::atomic<std::uintptr_t> src{reinterpret_cast<std::uintptr_t>(node) | 1u};
+
+    HazardPointer hp(domain);
+    std::uintptr_t v = hp.protect(src, [](std::uintptr_t x) {
+        return reinterpret_cast<TrackedNode*>(x & ~std::uintptr_t{7});
+    });
+    EXPECT_EQ(v, src.load());
+
+    src.store(0);
+    domain.retire(node);
+    domain.scan();
+    EXPECT_FALSE(node->reclaimed.load());
+
+    hp.reset_protection();
+    domain.scan();
+    EXPECT_TRUE(node->reclaimed.load());
+}
+
+// ============================================
+// Multithreaded Tests
+// ============================================
+
+TEST(HazardPointerTest, ReadersNeverSeeReclaimedNodes) {
+    Graveyard graveyard;
+    HazardPointerDomain domain(&Graveyard::reclaim, &graveyard);
+    std::atomic<TrackedNode*> shared{new TrackedNode(0)};
+
+    constexpr int NUM_READERS = 4;
+    constexpr int NUM_UPDATES = 20000;
+    std::atomic<bool> stop{false};
+    std::atomic<bool> saw_reclaimed{false};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < NUM_READERS; ++i) {
+        readers.emplace_back([&]() {
+            HazardPointer hp(domain);
+            while (!stop.load(std::memory_order_relaxed)) {
+                TrackedNode* node = hp.protect(shared);
+                if (node->reclaimed.load(std::memory_order_relaxed)) {
+                    saw_reclaimed.store(true, std::memory_order_relaxed);
+                }
+                hp.reset_protection();
+            }
+        });
+    }
+
+    std::thread writer([&]() {
+        for (int i = 1; i <= NUM_UPDATES; ++i) {
+            TrackedNode* old = shared.exchange(new TrackedNode(i));
+            domain.retire(old);
+        }
+    });
+
+    writer.join();
+    stop.store(true);
+    for (auto& t : readers) {
+        t.join();
+    }
+
+    EXPECT_FALSE(saw_reclaimed.load());
+    // 대부분은 이미 해제됨 (남은 수는 scan 임계값으로 제한)
+    EXPECT_LE(domain.retired_count(),
+              std::max<std::size_t>(HazardPointerDomain::SCAN_THRESHOLD, 2 * domain.record_count()));
+
+    domain.retire(shared.exchange(nullptr));
+}
@@ -0,0 +1,147 @@
+/**
+ * Indexed Memory Pool 테스트
+ *
+ * 32비트 인덱스 + 32비트 태그 free list 풀 테스트
+ */
+
+#include <gtest/gtest.h>
+#include <lockfree/indexed_memory_pool.hpp>
+#include <thread>
+#include <vector>
+#include <set>
+#include <atomic>
+#include <string>
+
+using namespace lockfree;
+
+// ========================================
+// 테스트 1: 기본 구조 테스트
+// ========================================
+
+TEST(IndexedMemoryPool, CapacityRoundsUpToPowerOfTwo) {
+    IndexedMemoryPool<int> pool(100);
+    EXPECT_EQ(pool.capacity(), 128u);
+    EXPECT_EQ(pool.allocated_count(), 0u);
+    EXPECT_EQ(pool.chunk_count(), 1u);
+}
+
+TEST(IndexedMemoryPool, IsLockFree) {
+    EXPECT_TRUE(IndexedMemoryPool<int>::is_lock_free());
+}
+
+TEST(IndexedMemoryPool, BlockSizeUsesFourByteLinks) {
+    // 링크가 인덱스(4바이트) → 작은 타입은 포인터 풀보다 블록이 작음
+    EXPECT_EQ(IndexedMemoryPool<std::uint32_t>::block_size(), 4u);
+    EXPECT_EQ(IndexedMemoryPool<char>::block_size(), 4u);
+    EXPECT_GE(IndexedMemoryPool<std::string>::block_size(), sizeof(std::string));
+}
+
+// ========================================
+// 테스트 2: 할당/해제
+// ========================================
+
+TEST(IndexedMemoryPool, AllocateReturnsDistinctIndices) {
+    IndexedMemoryPool<int> pool(64, false);
+    std::set<std::uint32_t> seen;
+    std::vector<std::uint32_t> indices;
+    for (int i = 0; i < 64; ++i) {
+        auto idx = pool.allocate();
+        ASSERT_NE(idx, IndexedMemoryPool<int>::NULL_INDEX);
+        EXPECT_TRUE(seen.insert(idx).second);
+        *pool.get(idx) = i;
+        indices.push_back(idx);
+    }
+    for (int i = 0; i < 64; ++i) {
+        EXPECT_EQ(*pool.get(indices[i]), i);
+    }
+
+    // 고정 크기 → 소진
+    EXPECT_EQ(pool.allocate(), IndexedMemoryPool<int>::NULL_INDEX);
+
+    for (auto idx : indices) {
+        pool.deallocate(idx);
+    }
+    EXPECT_EQ(pool.allocated_count(), 0u);
+}
+
+TEST(IndexedMemoryPool, GrowsByDoublingChunks) {
+    IndexedMemoryPool<std::uint64_t> pool(4);
+    std::vector<std::uint32_t> indices;
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        auto idx = pool.allocate();
+        ASSERT_NE(idx, IndexedMemoryPool<std::uint64_t>::NULL_INDEX);
+        *pool.get(idx) = i * 7;
+        indices.push_back(idx);
+    }
+    // 4 + 4 + 8 + 16 + 32 + 64 = 128 ≥ 100
+    EXPECT_EQ(pool.chunk_count(), 6u);
+    EXPECT_EQ(pool.capacity(), 128u);
+
+    // 청크 경계를 넘어도 인덱스 → 주소가 정확해야 함
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(*pool.get(indices[i]), i * 7);
+    }
+    for (auto idx : indices) {
+        pool.deallocate(idx);
+    }
+}
+
+TEST(IndexedMemoryPool, ConstructAndDestroy) {
+    IndexedMemoryPool<std::string> pool(8);
+    auto idx = pool.construct("hello indexed pool, long enough to heap allocate");
+    ASSERT_NE(idx, IndexedMemoryPool<std::string>::NULL_INDEX);
+    EXPECT_EQ(*pool.get(idx), "hello indexed pool, long enough to heap allocate");
+    pool.destroy(idx);
+    EXPECT_EQ(pool.allocated_count(), 0u);
+}
+
+// ========================================
+// 테스트 3: 멀티스레드
+// ========================================
+
+TEST(IndexedMemoryPool, ConcurrentAllocateDeallocate) {
+    IndexedMemoryPool<std::uint64_t> pool(16);
+    constexpr int NUM_THREADS = 4;
+    constexpr int ITERATIONS = 20000;
+    std::atomic<bool> corrupted{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&, t]() {
+            std::vector<std::uint32_t> held;
+            for (int i = 0; i < ITERATIONS; ++i) {
+                auto idx = pool.allocate();
+                if (idx == IndexedMemoryPool<std::uint64_t>::NULL_INDEX) {
+                    corrupted.store(true);
+                    return;
+                }
+                std::uint64_t stamp = (static_cast<std::uint64_t>(t) << 32) | static_cast<std::uint32_t>(i);
+                *pool.get(idx) = stamp;
+                held.push_back(idx);
+
+                // 몇 개씩 쥐고 있다가 한꺼번에 반환 (다른 스레드와 섞이도록)
+                if (held.size() == 8) {
+                    for (std::size_t k = 0; k < held.size(); ++k) {
+                        std::uint64_t expected =
+                            (static_cast<std::uint64_t>(t) << 32) |
+                            static_cast<std::uint32_t>(i - 7 + static_cast<int>(k));
+                        if (*pool.get(held[k]) != expected) {
+                            corrupted.store(true);
+                        }
+                        pool.deallocate(held[k]);
+                    }
+                    held.clear();
+                }
+            }
+            for (auto idx : held) {
+                pool.deallocate(idx);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_FALSE(corrupted.load()) << "two threads owned the same block";
+    EXPECT_EQ(pool.allocated_count(), 0u);
+}
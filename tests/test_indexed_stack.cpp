@@ -0,0 +1,120 @@
+/**
+ * Indexed Stack Test Suite
+ *
+ * Tests for the Treiber stack over 32-bit tagged indices
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <string>
+#include "lockfree/indexed_stack.hpp"
+
+// ============================================
+// Basic Functionality Tests
+// ============================================
+
+TEST(IndexedStackTest, IsLockFree) {
+    EXPECT_TRUE(lockfree::IndexedStack<int>::is_lock_free());
+}
+
+TEST(IndexedStackTest, LIFOOrder) {
+    lockfree::IndexedStack<int> stack;
+    EXPECT_TRUE(stack.empty());
+    EXPECT_FALSE(stack.pop().has_value());
+
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(stack.push(i));
+    }
+    for (int i = 9; i >= 0; --i) {
+        auto value = stack.pop();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_EQ(*value, i);
+    }
+    EXPECT_TRUE(stack.empty());
+}
+
+TEST(IndexedStackTest, GrowsBeyondInitialCapacity) {
+    lockfree::IndexedStack<int> stack(4);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(stack.push(i));
+    }
+    EXPECT_GE(stack.capacity(), 1000u);
+
+    int popped = 0;
+    while (stack.pop()) {
+        ++popped;
+    }
+    EXPECT_EQ(popped, 1000);
+}
+
+TEST(IndexedStackTest, NodesAreReusedNotReallocated) {
+    lockfree::IndexedStack<int> stack(16);
+    for (int round = 0; round < 100; ++round) {
+        for (int i = 0; i < 16; ++i) {
+            stack.push(i);
+        }
+        while (stack.pop()) {}
+    }
+    EXPECT_EQ(stack.capacity(), 16u);
+}
+
+TEST(IndexedStackTest, DestructorReleasesRemainingValues) {
+    auto token = std::make_shared<int>(0);
+    {
+        lockfree::IndexedStack<std::shared_ptr<int>> stack;
+        for (int i = 0; i < 10; ++i) {
+            stack.push(token);
+        }
+        EXPECT_EQ(token.use_count(), 11);
+        stack.pop();
+        EXPECT_EQ(token.use_count(), 10);
+    }
+    EXPECT_EQ(token.use_count(), 1);
+}
+
+TEST(IndexedStackTest, MoveOnlyType) {
+    lockfree::IndexedStack<std::unique_ptr<std::string>> stack;
+    stack.push(std::make_unique<std::string>("indexed"));
+    auto value = stack.pop();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(**value, "indexed");
+}
+
+// ============================================
+// Multithreaded Tests
+// ============================================
+
+TEST(IndexedStackTest, ConcurrentPushPopConservesSum) {
+    lockfree::IndexedStack<int> stack(64);
+    constexpr int NUM_THREADS = 4;
+    constexpr int ITERATIONS = 25000;
+    std::atomic<long long> pushed{0};
+    std::atomic<long long> popped{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < ITERATIONS; ++i) {
+                int value = t * ITERATIONS + i + 1;
+                stack.push(value);
+                pushed.fetch_add(value, std::memory_order_relaxed);
+                // push-pop 반복 = 같은 노드가 빠르게 재사용되는 ABA 유발 패턴
+                if (auto v = stack.pop()) {
+                    popped.fetch_add(*v, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    while (auto v = stack.pop()) {
+        popped.fetch_add(*v, std::memory_order_relaxed);
+    }
+
+    EXPECT_EQ(pushed.load(), popped.load());
+    EXPECT_TRUE(stack.empty());
+}
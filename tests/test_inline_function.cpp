@@ -0,0 +1,130 @@
+/**
+ * Inline Function Test Suite
+ *
+ * Tests for the fixed-capacity, allocation-free callable used by Job
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include "lockfree/inline_function.hpp"
+#include "lockfree/job_system.hpp"
+
+// ============================================
+// 전역 new 횟수 세기 (이 테스트 바이너리 전용)
+// ============================================
+
+namespace {
+std::atomic<std::size_t> g_allocations{0};
+}
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+using lockfree::InlineFunction;
+
+// ============================================
+// 기본 동작
+// ============================================
+
+TEST(InlineFunctionTest, EmptyByDefault) {
+    InlineFunction<void()> fn;
+    EXPECT_FALSE(static_cast<bool>(fn));
+}
+
+TEST(InlineFunctionTest, InvokesWithArgumentsAndReturn) {
+    int base = 10;
+    InlineFunction<int(int, int)> add = [&base](int a, int b) { return base + a + b; };
+    ASSERT_TRUE(static_cast<bool>(add));
+    EXPECT_EQ(add(1, 2), 13);
+}
+
+TEST(InlineFunctionTest, HoldsMoveOnlyCapture) {
+    // std::function은 복사 가능한 callable만 받음
+    auto owned = std::make_unique<int>(7);
+    InlineFunction<int()> fn = [p = std::move(owned)]() { return *p; };
+    EXPECT_EQ(fn(), 7);
+}
+
+TEST(InlineFunctionTest, DestroysCaptureOnResetAndDestruction) {
+    auto token = std::make_shared<int>(0);
+    {
+        InlineFunction<void()> fn = [token]() {};
+        EXPECT_EQ(token.use_count(), 2);
+
+        fn.reset();
+        EXPECT_EQ(token.use_count(), 1);
+        EXPECT_FALSE(static_cast<bool>(fn));
+
+        fn.emplace([token]() {});
+        EXPECT_EQ(token.use_count(), 2);
+    }
+    EXPECT_EQ(token.use_count(), 1);
+}
+
+TEST(InlineFunctionTest, CapacityCheckIsCompileTime) {
+    struct Small { char bytes[48]; void operator()() const {} };
+    struct Large { char bytes[49]; void operator()() const {} };
+    static_assert(InlineFunction<void(), 48>::fits<Small>);
+    static_assert(!InlineFunction<void(), 48>::fits<Large>);
+    static_assert(sizeof(InlineFunction<void(), 48>) == 64);
+    SUCCEED();
+}
+
+TEST(InlineFunctionTest, LargeCaptureDoesNotAllocate) {
+    // libstdc++의 std::function SBO(16바이트)를 넘는 캡처
+    long long a = 1, b = 2, c = 3, d = 4, e = 5;
+    long long result = 0;
+
+    std::size_t before = g_allocations.load();
+    {
+        InlineFunction<void()> fn = [a, b, c, d, e, &result]() { result = a + b + c + d + e; };
+        fn();
+    }
+    EXPECT_EQ(g_allocations.load(), before);
+    EXPECT_EQ(result, 15);
+}
+
+// ============================================
+// Job과의 통합
+// ============================================
+
+TEST(InlineFunctionTest, JobIsTwoCacheLines) {
+    EXPECT_EQ(sizeof(lockfree::Job), 128u);
+    EXPECT_EQ(alignof(lockfree::Job), 64u);
+}
+
+TEST(InlineFunctionTest, ScheduleDoesNotAllocate) {
+    lockfree::JobSystem js(2);
+    std::atomic<long long> sum{0};
+    lockfree::Counter counter(0);
+
+    // 풀 블록이 미리 있으므로 schedule은 할당 없이 끝나야 함
+    long long x = 1, y = 2, z = 3, w = 4;
+    std::size_t before = g_allocations.load();
+    for (int i = 0; i < 100; ++i) {
+        js.schedule([&sum, x, y, z, w]() {
+            sum.fetch_add(x + y + z + w, std::memory_order_relaxed);
+        }, &counter);
+    }
+    std::size_t after = g_allocations.load();
+    js.wait_for_counter(&counter);
+
+    EXPECT_EQ(after, before);
+    EXPECT_EQ(sum.load(), 1000);
+}
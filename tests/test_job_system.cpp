@@ -18,6 +18,7 @@
 #include <chrono>
 #include <numeric>
 #include <random>
+#include <functional>
 
 using namespace lockfree;
 
@@ -315,7 +316,7 @@ TEST(JobSystem, StressTest) {
             // 약간의 작업 시뮬레이션
             volatile int dummy = 0;
             for (int j = 0; j < 100; ++j) {
-                dummy += j;
+                dummy = dummy + j;
             }
             executed.fetch_add(1, std::memory_order_relaxed);
         }, &counter);
@@ -373,6 +374,233 @@ TEST(JobSystem, WaitAll) {
     EXPECT_EQ(count.load(), 100);
 }
 
+// ========================================
+// Step 8: Work Stealing 모드
+// ========================================
+
+/**
+ * 모드 선택
+ */
+TEST(JobSystemWorkStealing, ModeSelectedAtConstruction) {
+    JobSystem shared(2);
+    EXPECT_EQ(shared.mode(), SchedulerMode::SharedQueue);
+
+    JobSystem stealing(2, SchedulerMode::WorkStealing);
+    EXPECT_EQ(stealing.mode(), SchedulerMode::WorkStealing);
+    EXPECT_EQ(stealing.worker_count(), 2);
+}
+
+/**
+ * 외부 제출 Job (공유 큐 경로)
+ */
+TEST(JobSystemWorkStealing, ExternalSubmissions) {
+    constexpr int NUM_JOBS = 10000;
+
+    JobSystem js(4, SchedulerMode::WorkStealing);
+
+    std::atomic<long long> sum{0};
+    Counter counter(0);
+
+    for (int i = 1; i <= NUM_JOBS; ++i) {
+        js.schedule([&sum, value = i]() {
+            sum.fetch_add(value, std::memory_order_relaxed);
+        }, &counter);
+    }
+
+    js.wait_for_counter(&counter);
+
+    EXPECT_EQ(sum.load(), static_cast<long long>(NUM_JOBS) * (NUM_JOBS + 1) / 2);
+    EXPECT_EQ(js.pending_jobs(), 0);
+}
+
+/**
+ * 워커 안에서 만든 Job (로컬 deque 경로 + 훔치기)
+ *
+ * Job 하나가 자식 Job을 잔뜩 만들면 모두 그 워커의 deque로 들어감
+ * → 다른 워커가 훔쳐 가야 여러 스레드에서 실행됨
+ */
+TEST(JobSystemWorkStealing, NestedJobsGoToLocalDeque) {
+    constexpr int NUM_CHILDREN = 2000;
+
+    JobSystem js(4, SchedulerMode::WorkStealing);
+
+    std::atomic<int> executed{0};
+    Counter parent_done(0);
+    Counter children(0);
+
+    js.schedule([&]() {
+        for (int i = 0; i < NUM_CHILDREN; ++i) {
+            js.schedule([&]() {
+                volatile int dummy = 0;
+                for (int j = 0; j < 100; ++j) {
+                    dummy = dummy + j;
+                }
+                executed.fetch_add(1, std::memory_order_relaxed);
+            }, &children);
+        }
+    }, &parent_done);
+
+    js.wait_for_counter(&parent_done);
+    js.wait_for_counter(&children);
+
+    EXPECT_EQ(executed.load(), NUM_CHILDREN);
+    js.wait_all();
+    EXPECT_EQ(js.pending_jobs(), 0);
+}
+
+/**
+ * 재귀 분할 (fork-join): 각 Job이 범위를 반으로 나눠 자식 두 개를 만듦
+ */
+TEST(JobSystemWorkStealing, RecursiveSplit) {
+    constexpr int SIZE = 1 << 14;
+    constexpr int LEAF = 64;
+
+    JobSystem js(4, SchedulerMode::WorkStealing);
+
+    std::vector<int> data(SIZE);
+    std::iota(data.begin(), data.end(), 1);
+    std::atomic<long long> sum{0};
+    Counter counter(0);
+
+    std::function<void(int, int)> split = [&](int begin, int end) {
+        if (end - begin <= LEAF) {
+            long long local = 0;
+            for (int i = begin; i < end; ++i) {
+                local += data[i];
+            }
+            sum.fetch_add(local, std::memory_order_relaxed);
+            return;
+        }
+        int mid = begin + (end - begin) / 2;
+        js.schedule([&split, begin, mid]() { split(begin, mid); }, &counter);
+        js.schedule([&split, mid, end]() { split(mid, end); }, &counter);
+    };
+
+    js.schedule([&]() { split(0, SIZE); }, &counter);
+    js.wait_for_counter(&counter);
+
+    EXPECT_EQ(sum.load(), static_cast<long long>(SIZE) * (SIZE + 1) / 2);
+}
+
+/**
+ * 반복 사용 + 남은 Job 정리
+ */
+TEST(JobSystemWorkStealing, RepeatedScheduleWait) {
+    JobSystem js(4, SchedulerMode::WorkStealing);
+
+    for (int round = 0; round < 100; ++round) {
+        std::atomic<int> count{0};
+        Counter counter(0);
+
+        for (int i = 0; i < 10; ++i) {
+            js.schedule([&]() {
+                count.fetch_add(1, std::memory_order_relaxed);
+            }, &counter);
+        }
+
+        js.wait_for_counter(&counter);
+
+        EXPECT_EQ(count.load(), 10) << "Round " << round << " failed";
+    }
+}
+
+// ========================================
+// Step 9: 큐 넘침 정책
+// ========================================
+
+namespace {
+
+struct OverflowRun {
+    int scheduled = 0;
+    int rejected = 0;
+    int ran_on_caller_before_release = 0;
+    int executed = 0;
+};
+
+/**
+ * 워커 하나를 막아 두고 공유 큐 용량 + extra 개를 schedule
+ */
+OverflowRun run_overflow(OverflowPolicy policy, int extra) {
+    JobSystem js(1, SchedulerMode::SharedQueue, policy);
+    EXPECT_EQ(js.overflow_policy(), policy);
+
+    std::atomic<bool> started{false};
+    std::atomic<bool> release{false};
+    std::atomic<int> executed{0};
+    std::atomic<int> on_caller{0};
+    const auto caller = std::this_thread::get_id();
+    Counter counter(0);
+
+    // 유일한 워커를 붙잡아 둠 → 큐가 줄지 않음
+    js.schedule([&]() {
+        started.store(true);
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+    }, &counter);
+    while (!started.load()) {
+        std::this_thread::yield();
+    }
+
+    OverflowRun run;
+    const int total = static_cast<int>(JobSystem::DEFAULT_QUEUE_SIZE) + extra;
+    for (int i = 0; i < total; ++i) {
+        bool ok = js.schedule([&]() {
+            if (std::this_thread::get_id() == caller && !release.load()) {
+                on_caller.fetch_add(1);
+            }
+            executed.fetch_add(1);
+        }, &counter);
+        ++run.scheduled;
+        if (!ok) {
+            ++run.rejected;
+        }
+    }
+    run.ran_on_caller_before_release = on_caller.load();
+
+    release.store(true);
+    js.wait_for_counter(&counter);
+    js.wait_all();
+    run.executed = executed.load();
+
+    EXPECT_EQ(js.pending_jobs(), 0);
+    EXPECT_GE(js.overflow_count(), static_cast<std::size_t>(extra));
+    if (policy == OverflowPolicy::Reject) {
+        EXPECT_EQ(js.overflow_count(), static_cast<std::size_t>(run.rejected));
+    }
+    return run;
+}
+
+} // namespace
+
+TEST(JobSystemOverflow, HelpUntilSpaceRunsQueuedJobs) {
+    auto run = run_overflow(OverflowPolicy::HelpUntilSpace, 100);
+    EXPECT_EQ(run.rejected, 0);
+    EXPECT_GT(run.ran_on_caller_before_release, 0);  // 호출자가 큐의 Job을 대신 실행
+    EXPECT_EQ(run.executed, run.scheduled);
+}
+
+TEST(JobSystemOverflow, RunInlineExecutesOnCaller) {
+    auto run = run_overflow(OverflowPolicy::RunInline, 100);
+    EXPECT_EQ(run.rejected, 0);
+    EXPECT_GE(run.ran_on_caller_before_release, 100);
+    EXPECT_EQ(run.executed, run.scheduled);
+}
+
+TEST(JobSystemOverflow, SpillKeepsEveryJob) {
+    auto run = run_overflow(OverflowPolicy::Spill, 1000);
+    EXPECT_EQ(run.rejected, 0);
+    EXPECT_EQ(run.ran_on_caller_before_release, 0);  // 호출자는 막히지 않음
+    EXPECT_EQ(run.executed, run.scheduled);
+}
+
+TEST(JobSystemOverflow, RejectReturnsFailure) {
+    auto run = run_overflow(OverflowPolicy::Reject, 100);
+    EXPECT_GE(run.rejected, 100);
+    EXPECT_EQ(run.ran_on_caller_before_release, 0);
+    EXPECT_EQ(run.executed, run.scheduled - run.rejected);
+}
+
 // ========================================
 // 고급: Parent-Child 테스트 (선택적)
 // ========================================
@@ -383,23 +611,78 @@ TEST(JobSystem, WaitAll) {
  * 이 테스트는 고급 기능입니다.
  * 먼저 기본 테스트들을 모두 통과시킨 후 도전하세요!
  */
-TEST(JobSystem, DISABLED_ParentChildJobs) {
+TEST(JobSystem, ParentChildJobs) {
     JobSystem js(4);
     
     std::atomic<int> parent_finished{0};
     std::atomic<int> children_finished{0};
     
-    // TODO: Parent-Child 관계 구현 후 활성화
-    // 
     // Parent Job은 모든 Child가 완료된 후 완료되어야 함
     // 
     // Parent
     //   ├── Child 1
     //   ├── Child 2
     //   └── Child 3
+    Counter counter(0);
+    Job* parent = js.allocate_job();
+    parent->counter = &counter;
+    parent->function.emplace([&js, &children_finished, &parent_finished, parent]() {
+        for (int i = 0; i < 3; ++i) {
+            js.schedule_child(parent, [&children_finished]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                children_finished.fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+        parent_finished.fetch_add(1, std::memory_order_relaxed);
+    });
+    counter.increment();
+    ASSERT_TRUE(js.schedule(parent));
+
+    // counter는 부모 함수가 아니라 자식까지 모두 끝나야 0
+    js.wait_for_counter(&counter);
     
     EXPECT_EQ(children_finished.load(), 3);
     EXPECT_EQ(parent_finished.load(), 1);
+    js.wait_all();
+    EXPECT_EQ(js.pending_jobs(), 0);
+}
+
+/**
+ * 자식이 손자를 만드는 트리: 루트 counter는 트리 전체가 끝날 때 한 번만 감소
+ */
+TEST(JobSystemWorkStealing, NestedChildTreeCompletesOnce) {
+    constexpr int FANOUT = 4;
+
+    JobSystem js(4, SchedulerMode::WorkStealing);
+    std::atomic<int> leaves{0};
+
+    Counter counter(0);
+    Job* root = js.allocate_job();
+    root->counter = &counter;
+    root->function.emplace([&js, &leaves, root]() {
+        for (int i = 0; i < FANOUT; ++i) {
+            Job* child = js.allocate_job();
+            ASSERT_NE(child, nullptr);
+            child->parent = root;
+            child->function.emplace([&js, &leaves, child]() {
+                for (int j = 0; j < FANOUT; ++j) {
+                    js.schedule_child(child, [&leaves]() {
+                        leaves.fetch_add(1, std::memory_order_relaxed);
+                    });
+                }
+            });
+            root->unfinished_jobs.fetch_add(1, std::memory_order_relaxed);
+            js.schedule(child);
+        }
+    });
+    counter.increment();
+    ASSERT_TRUE(js.schedule(root));
+
+    js.wait_for_counter(&counter);
+    EXPECT_EQ(leaves.load(), FANOUT * FANOUT);
+    EXPECT_EQ(counter.get(), 0);
+    js.wait_all();
+    EXPECT_EQ(js.pending_jobs(), 0);
 }
 
 // ========================================
@@ -0,0 +1,151 @@
+/**
+ * Lock Profiler Test Suite
+ *
+ * Tests for per-lock contention statistics (built with LOCKFREE_LOCK_PROFILING)
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include "lockfree/spinlock.hpp"
+#include "lockfree/lock_profiler.hpp"
+
+using namespace lockfree;
+
+namespace {
+
+// 주소로 레지스트리에서 해당 락의 통계를 찾음
+LockStatsSnapshot find_stats(const void* lock) {
+    for (const auto& s : LockProfiler::instance().snapshot()) {
+        if (s.address == lock && !s.destroyed) {
+            return s;
+        }
+    }
+    ADD_FAILURE() << "lock not registered";
+    return {};
+}
+
+} // namespace
+
+TEST(LockProfilerTest, EnabledInThisBuild) {
+    EXPECT_TRUE(LockProfiler::enabled);
+}
+
+TEST(LockProfilerTest, CountsUncontendedAcquisitions) {
+    SpinLock lock("uncontended");
+    for (int i = 0; i < 10; ++i) {
+        SpinLockGuard guard(lock);
+    }
+    EXPECT_TRUE(lock.try_lock());
+    lock.unlock();
+
+    LockStatsSnapshot s = find_stats(&lock);
+    EXPECT_EQ(s.name, "uncontended");
+    EXPECT_EQ(s.acquisitions, 11u);
+    EXPECT_EQ(s.contended, 0u);
+    EXPECT_EQ(s.wait_cycles, 0u);
+    EXPECT_EQ(s.slow_path, 0u);
+}
+
+TEST(LockProfilerTest, RecordsContendedSlowPath) {
+    SpinLock lock("slow-path");
+    lock.lock();
+
+    std::atomic<bool> started{false};
+    std::thread waiter([&]() {
+        started.store(true);
+        lock.lock();
+        lock.unlock();
+    });
+    while (!started.load()) {
+        std::this_thread::yield();
+    }
+    // 스핀 예산(32 pause)보다 훨씬 오래 보유 → waiter는 futex 대기로 감
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    lock.unlock();
+    waiter.join();
+
+    LockStatsSnapshot s = find_stats(&lock);
+    EXPECT_EQ(s.acquisitions, 2u);
+    EXPECT_EQ(s.contended, 1u);
+    EXPECT_EQ(s.slow_path, 1u);
+    EXPECT_GT(s.spin_iterations, 0u);
+    EXPECT_GT(s.wait_cycles, 0u);
+    EXPECT_GT(s.hold_cycles, 0u);
+}
+
+TEST(LockProfilerTest, CountsEveryAcquisitionUnderContention) {
+    SpinLock lock("counter");
+    constexpr int NUM_THREADS = 4;
+    constexpr int ITERATIONS = 5000;
+    long long counter = 0;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < ITERATIONS; ++j) {
+                SpinLockGuard guard(lock);
+                ++counter;
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    // 통계는 보유자만 갱신 → 경합 중에도 정확히 맞아야 함
+    LockStatsSnapshot s = find_stats(&lock);
+    EXPECT_EQ(counter, NUM_THREADS * ITERATIONS);
+    EXPECT_EQ(s.acquisitions, static_cast<std::uint64_t>(NUM_THREADS * ITERATIONS));
+    EXPECT_LE(s.contended, s.acquisitions);
+    EXPECT_LE(s.slow_path, s.contended);
+}
+
+TEST(LockProfilerTest, AdaptiveSpinLockIsProfiled) {
+    AdaptiveSpinLock lock("adaptive");
+    lock.lock();
+    lock.unlock();
+    EXPECT_EQ(find_stats(&lock).acquisitions, 1u);
+}
+
+TEST(LockProfilerTest, DumpTopSortsAndKeepsDestroyedLocks) {
+    LockProfiler::instance().reset();
+
+    SpinLock hot("hot-lock");
+    SpinLock cold("cold-lock");
+    for (int i = 0; i < 100; ++i) {
+        SpinLockGuard guard(hot);
+    }
+    {
+        SpinLockGuard guard(cold);
+    }
+    {
+        SpinLock temporary("short-lived");
+        SpinLockGuard guard(temporary);
+    }
+
+    auto top = LockProfiler::instance().top(2, LockProfiler::SortBy::Acquisitions);
+    ASSERT_EQ(top.size(), 2u);
+    EXPECT_EQ(top[0].name, "hot-lock");
+    EXPECT_EQ(top[0].acquisitions, 100u);
+
+    std::ostringstream out;
+    LockProfiler::instance().dump_top(out, 10, LockProfiler::SortBy::Acquisitions);
+    std::string report = out.str();
+    EXPECT_NE(report.find("hot-lock"), std::string::npos);
+    EXPECT_NE(report.find("cold-lock"), std::string::npos);
+    EXPECT_NE(report.find("short-lived (dead)"), std::string::npos);
+    EXPECT_LT(report.find("hot-lock"), report.find("cold-lock"));
+}
+
+TEST(LockProfilerTest, ResetClearsCounters) {
+    SpinLock lock("reset");
+    lock.lock();
+    lock.unlock();
+    LockProfiler::instance().reset();
+    EXPECT_EQ(find_stats(&lock).acquisitions, 0u);
+}
@@ -0,0 +1,265 @@
+/**
+ * MCS Lock Test Suite
+ *
+ * Tests for queue-based (MCS) spinlock
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <stdexcept>
+#include "lockfree/mcs_lock.hpp"
+
+// ============================================
+// Basic Functionality Tests
+// ============================================
+
+TEST(MCSLockTest, LockUnlockWithNode) {
+    lockfree::MCSLock lock;
+    lockfree::MCSNode node;
+    lock.lock(node);
+    EXPECT_TRUE(lock.is_locked());
+    lock.unlock(node);
+    EXPECT_FALSE(lock.is_locked());
+}
+
+TEST(MCSLockTest, LockUnlockThreadLocal) {
+    lockfree::MCSLock lock;
+    for (int i = 0; i < 100; ++i) {
+        lock.lock();
+        lock.unlock();
+    }
+    EXPECT_FALSE(lock.is_locked());
+}
+
+TEST(MCSLockTest, TryLockFail) {
+    lockfree::MCSLock lock;
+    lock.lock();
+
+    std::atomic<bool> try_lock_result{true};
+    std::thread t([&lock, &try_lock_result]() {
+        try_lock_result = lock.try_lock();
+    });
+    t.join();
+
+    EXPECT_FALSE(try_lock_result);
+    lock.unlock();
+    EXPECT_TRUE(lock.try_lock());
+    lock.unlock();
+}
+
+TEST(MCSLockTest, NestedDifferentLocks) {
+    // thread-local 노드가 락마다 따로 할당되어야 함
+    lockfree::MCSLock a;
+    lockfree::MCSLock b;
+    lockfree::MCSLock c;
+
+    a.lock();
+    b.lock();
+    c.lock();
+    // 비-LIFO 순서로 해제해도 노드가 섞이면 안 됨
+    a.unlock();
+    c.unlock();
+    b.unlock();
+
+    EXPECT_FALSE(a.is_locked());
+    EXPECT_FALSE(b.is_locked());
+    EXPECT_FALSE(c.is_locked());
+}
+
+TEST(MCSLockTest, StdLockGuardCompatible) {
+    lockfree::MCSLock lock;
+    {
+        std::lock_guard<lockfree::MCSLock> guard(lock);
+        EXPECT_TRUE(lock.is_locked());
+    }
+    EXPECT_FALSE(lock.is_locked());
+}
+
+// ============================================
+// MCSLockGuard Tests
+// ============================================
+
+TEST(MCSLockGuardTest, ExceptionSafety) {
+    lockfree::MCSLock lock;
+    try {
+        lockfree::MCSLockGuard guard(lock);
+        throw std::runtime_error("test exception");
+    } catch (...) {
+        // Lock should be released even after exception
+    }
+    EXPECT_TRUE(lock.try_lock());
+    lock.unlock();
+}
+
+// ============================================
+// Multithreaded Tests
+// ============================================
+
+TEST(MCSLockTest, ConcurrentIncrementWithGuard) {
+    lockfree::MCSLock lock;
+    int counter = 0;
+    constexpr int NUM_THREADS = 4;
+    constexpr int INCREMENTS_PER_THREAD = 10000;
+
+    std::vector<std::thread> threads;
+    threads.reserve(NUM_THREADS);
+
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&lock, &counter]() {
+            for (int j = 0; j < INCREMENTS_PER_THREAD; ++j) {
+                lockfree::MCSLockGuard guard(lock);
+                ++counter;
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(counter, NUM_THREADS * INCREMENTS_PER_THREAD);
+}
+
+TEST(MCSLockTest, MutualExclusion) {
+    lockfree::MCSLock lock;
+    std::atomic<int> in_critical_section{0};
+    std::atomic<bool> violation_detected{false};
+    constexpr int NUM_THREADS = 8;
+    constexpr int ITERATIONS = 1000;
+
+    std::vector<std::thread> threads;
+    threads.reserve(NUM_THREADS);
+
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < ITERATIONS; ++j) {
+                lock.lock();
+
+                int prev = in_critical_section.fetch_add(1, std::memory_order_relaxed);
+                if (prev != 0) {
+                    violation_detected.store(true, std::memory_order_relaxed);
+                }
+                std::this_thread::yield();
+                in_critical_section.fetch_sub(1, std::memory_order_relaxed);
+
+                lock.unlock();
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_FALSE(violation_detected.load());
+    EXPECT_EQ(in_critical_section.load(), 0);
+}
+
+TEST(MCSLockTest, FIFOHandoff) {
+    // 대기열에 들어간 순서대로 락을 넘겨받아야 함
+    lockfree::MCSLock lock;
+    lockfree::MCSNode holder;
+    lock.lock(holder);
+
+    constexpr int NUM_WAITERS = 4;
+    std::vector<int> order;
+    std::atomic<int> enqueued{0};
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < NUM_WAITERS; ++i) {
+        // 이전 대기자가 tail_에 합류할 때까지 기다렸다가 다음 스레드 시작
+        threads.emplace_back([&, i]() {
+            lockfree::MCSNode node;
+            enqueued.fetch_add(1, std::memory_order_release);
+            lock.lock(node);
+            order.push_back(i);
+            lock.unlock(node);
+        });
+        while (enqueued.load(std::memory_order_acquire) != i + 1) {
+            std::this_thread::yield();
+        }
+        // exchange가 끝날 시간을 줌
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    lock.unlock(holder);
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    ASSERT_EQ(order.size(), static_cast<size_t>(NUM_WAITERS));
+    for (int i = 0; i < NUM_WAITERS; ++i) {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+TEST(MCSLockTest, SleepingWaiterFreesNodeRightAfterHandoff) {
+    // 잠든 대기자는 넘겨받자마자 unlock하고 노드를 해제함
+    // unlock이 GRANTED 이후에 후속자 노드를 건드리면 해제된 메모리 접근 (ASan에서 검출)
+    lockfree::MCSLock lock;
+    constexpr int ROUNDS = 50;
+
+    for (int round = 0; round < ROUNDS; ++round) {
+        auto holder = std::make_unique<lockfree::MCSNode>();
+        lock.lock(*holder);
+
+        std::atomic<bool> enqueued{false};
+        std::thread waiter([&]() {
+            auto node = std::make_unique<lockfree::MCSNode>();
+            enqueued.store(true, std::memory_order_release);
+            lock.lock(*node);
+            lock.unlock(*node);
+            node.reset();
+        });
+
+        while (!enqueued.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        // 대기자가 스핀을 다 쓰고 잠들 시간을 줌
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        lock.unlock(*holder);
+        waiter.join();
+    }
+    EXPECT_FALSE(lock.is_locked());
+}
+
+// ============================================
+// Stress Tests
+// ============================================
+
+TEST(MCSLockTest, StressTest) {
+    lockfree::MCSLock lock;
+    long long counter = 0;
+    constexpr int NUM_THREADS = 8;
+    constexpr int ITERATIONS = 50000;
+
+    std::vector<std::thread> threads;
+    threads.reserve(NUM_THREADS);
+
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&lock, &counter, i]() {
+            for (int j = 0; j < ITERATIONS; ++j) {
+                // 노드 제공 방식 두 가지를 섞어서 사용
+                if ((i + j) % 2 == 0) {
+                    lockfree::MCSLockGuard guard(lock);
+                    ++counter;
+                } else {
+                    std::lock_guard<lockfree::MCSLock> guard(lock);
+                    ++counter;
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(counter, static_cast<long long>(NUM_THREADS) * ITERATIONS);
+}
@@ -13,6 +13,7 @@
 #include <atomic>
 #include <chrono>
 #include <random>
+#include <cstdint>
 
 using namespace lockfree;
 
@@ -294,6 +295,57 @@ TEST(MemoryPool, ConcurrentAllocateDeallocate) {
     std::cout << "[  INFO    ] Pool final capacity: " << pool.capacity() << "\n";
 }
 
+TEST(MemoryPool, ConcurrentGrowthFromTinyPool) {
+    // 블록 1개짜리 청크 → 거의 모든 할당이 add_chunk
+    // 여러 스레드가 동시에 확장 → chunks_ 벡터 재할당이 다른 스레드의 청크 초기화와 겹침
+    constexpr int NUM_THREADS = 8;
+    constexpr int ALLOCS_PER_THREAD = 2000;
+    
+    MemoryPool<std::uint64_t> pool(1, true, 1);
+    
+    std::atomic<bool> start{false};
+    std::vector<std::vector<std::uint64_t*>> allocated(NUM_THREADS);
+    
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&, t]() {
+            allocated[t].reserve(ALLOCS_PER_THREAD);
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < ALLOCS_PER_THREAD; ++i) {
+                std::uint64_t* ptr = pool.allocate();
+                ASSERT_NE(ptr, nullptr);
+                *ptr = static_cast<std::uint64_t>(t) * ALLOCS_PER_THREAD + i;
+                allocated[t].push_back(ptr);
+            }
+        });
+    }
+    start.store(true, std::memory_order_release);
+    for (auto& th : threads) {
+        th.join();
+    }
+    
+    // 모든 블록이 서로 다르고, 다른 스레드의 확장이 값을 덮어쓰지 않았어야 함
+    std::set<std::uint64_t*> unique_blocks;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        for (int i = 0; i < ALLOCS_PER_THREAD; ++i) {
+            std::uint64_t* ptr = allocated[t][i];
+            EXPECT_EQ(*ptr, static_cast<std::uint64_t>(t) * ALLOCS_PER_THREAD + i);
+            unique_blocks.insert(ptr);
+        }
+    }
+    EXPECT_EQ(unique_blocks.size(), static_cast<std::size_t>(NUM_THREADS) * ALLOCS_PER_THREAD);
+    EXPECT_GE(pool.capacity(), static_cast<std::size_t>(NUM_THREADS) * ALLOCS_PER_THREAD);
+    
+    for (auto& blocks : allocated) {
+        for (std::uint64_t* ptr : blocks) {
+            pool.deallocate(ptr);
+        }
+    }
+    EXPECT_EQ(pool.allocated_count(), 0);
+}
+
 // ========================================
 // 테스트 6: 데이터 무결성 테스트
 // ========================================
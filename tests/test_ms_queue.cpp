@@ -0,0 +1,217 @@
+/**
+ * Michael-Scott Queue Test Suite
+ *
+ * Tests for the unbounded lock-free MPMC linked queue
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <string>
+#include "lockfree/ms_queue.hpp"
+
+// ============================================
+// Basic Functionality Tests
+// ============================================
+
+TEST(MSQueueTest, PopFromEmpty) {
+    lockfree::MSQueue<int> queue;
+    int value;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop(value));
+}
+
+TEST(MSQueueTest, FIFOOrder) {
+    lockfree::MSQueue<int> queue;
+    for (int i = 0; i < 100; ++i) {
+        queue.push(i);
+    }
+    EXPECT_FALSE(queue.empty());
+
+    int value;
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.pop(value));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(MSQueueTest, Unbounded) {
+    // 링 버퍼 큐와 달리 가득 참이 없음
+    lockfree::MSQueue<int> queue;
+    constexpr int COUNT = 100000;
+    for (int i = 0; i < COUNT; ++i) {
+        queue.push(i);
+    }
+    int value;
+    int popped = 0;
+    while (queue.pop(value)) {
+        ++popped;
+    }
+    EXPECT_EQ(popped, COUNT);
+}
+
+TEST(MSQueueTest, MoveOnlyType) {
+    lockfree::MSQueue<std::unique_ptr<std::string>> queue;
+    queue.push(std::make_unique<std::string>("hello"));
+
+    std::unique_ptr<std::string> out;
+    ASSERT_TRUE(queue.pop(out));
+    ASSERT_NE(out, nullptr);
+    EXPECT_EQ(*out, "hello");
+}
+
+TEST(MSQueueTest, DestructorReleasesRemainingValues) {
+    auto counter = std::make_shared<int>(0);
+    {
+        lockfree::MSQueue<std::shared_ptr<int>> queue;
+        for (int i = 0; i < 10; ++i) {
+            queue.push(counter);
+        }
+        std::shared_ptr<int> out;
+        queue.pop(out);
+        queue.pop(out);
+        EXPECT_EQ(counter.use_count(), 10);  // 큐 8개 + out + counter
+    }
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+// ============================================
+// Multithreaded Tests
+// ============================================
+
+namespace {
+
+template <typename Queue>
+void run_mpmc_stress() {
+    Queue queue;
+    constexpr int NUM_PRODUCERS = 4;
+    constexpr int NUM_CONSUMERS = 4;
+    constexpr int PER_PRODUCER = 25000;
+    constexpr int TOTAL = NUM_PRODUCERS * PER_PRODUCER;
+
+    std::atomic<long long> sum{0};
+    std::atomic<int> consumed{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < NUM_PRODUCERS; ++p) {
+        threads.emplace_back([&, p]() {
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                queue.push(p * PER_PRODUCER + i + 1);
+            }
+        });
+    }
+    for (int c = 0; c < NUM_CONSUMERS; ++c) {
+        threads.emplace_back([&]() {
+            int value;
+            while (consumed.load(std::memory_order_relaxed) < TOTAL) {
+                if (queue.pop(value)) {
+                    sum.fetch_add(value, std::memory_order_relaxed);
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    long long expected = static_cast<long long>(TOTAL) * (TOTAL + 1) / 2;
+    EXPECT_EQ(sum.load(), expected);
+    EXPECT_TRUE(queue.empty());
+}
+
+} // namespace
+
+TEST(MSQueueTest, MPMCStress) {
+    run_mpmc_stress<lockfree::MSQueue<int>>();
+}
+
+TEST(MSQueueTest, MPMCStressEpochReclaimer) {
+    run_mpmc_stress<lockfree::MSQueue<int, lockfree::EpochReclaimer>>();
+}
+
+TEST(MSQueueTest, MPMCStressHeapAllocator) {
+    run_mpmc_stress<lockfree::MSQueue<int, lockfree::HazardPointerReclaimer, lockfree::HeapAllocator>>();
+}
+
+TEST(MSQueueTest, PerProducerOrderPreserved) {
+    lockfree::MSQueue<int> queue;
+    constexpr int NUM_PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 20000;
+    constexpr int TOTAL = NUM_PRODUCERS * PER_PRODUCER;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < NUM_PRODUCERS; ++p) {
+        producers.emplace_back([&, p]() {
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                queue.push(p * PER_PRODUCER + i);
+            }
+        });
+    }
+
+    // 소비자 하나: 생산자별 순서는 유지되어야 함 (FIFO)
+    std::vector<int> last(NUM_PRODUCERS, -1);
+    bool in_order = true;
+    int received = 0;
+    int value;
+    while (received < TOTAL) {
+        if (queue.pop(value)) {
+            int p = value / PER_PRODUCER;
+            if (value <= last[p]) {
+                in_order = false;
+            }
+            last[p] = value;
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+
+    EXPECT_TRUE(in_order);
+}
+
+TEST(MSQueueTest, ConcurrentBurstGrowsNodePool) {
+    // 소비자 없이 생산자들이 동시에 몰아서 push → 노드 풀 청크가 여러 스레드에서 동시에 추가됨
+    lockfree::MSQueue<int> queue;
+    constexpr int NUM_PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 20000;
+
+    std::atomic<bool> start{false};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < NUM_PRODUCERS; ++p) {
+        producers.emplace_back([&, p]() {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                queue.push(p * PER_PRODUCER + i);
+            }
+        });
+    }
+    start.store(true, std::memory_order_release);
+    for (auto& t : producers) {
+        t.join();
+    }
+
+    std::vector<int> next(NUM_PRODUCERS, 0);
+    bool in_order = true;
+    int value;
+    while (queue.pop(value)) {
+        int p = value / PER_PRODUCER;
+        in_order = in_order && value == p * PER_PRODUCER + next[p];
+        ++next[p];
+    }
+    EXPECT_TRUE(in_order);
+    for (int p = 0; p < NUM_PRODUCERS; ++p) {
+        EXPECT_EQ(next[p], PER_PRODUCER);
+    }
+}
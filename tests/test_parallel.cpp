@@ -0,0 +1,455 @@
+/**
+ * Parallel Algorithms 테스트
+ *
+ * JobSystem 위의 parallel_for (재귀 + 게으른 분할),
+ * parallel_reduce / parallel_inclusive_scan (고정 분할 + 부모/자식 Job),
+ * parallel_sort (기수 정렬 / 샘플 정렬)
+ */
+
+#include <gtest/gtest.h>
+#include <lockfree/parallel.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace lockfree;
+
+// ========================================
+// parallel_for
+// ========================================
+
+TEST(ParallelFor, EmptyRange) {
+    JobSystem js(2);
+    int calls = 0;
+    EXPECT_EQ(parallel_for(js, 5, 5, 1, [&](int) { ++calls; }), 0u);
+    EXPECT_EQ(parallel_for(js, 5, 3, 1, [&](int) { ++calls; }), 0u);
+    EXPECT_EQ(calls, 0);
+}
+
+TEST(ParallelFor, SmallerThanGrainRunsOnCaller) {
+    JobSystem js(2);
+    std::vector<int> data(100, 0);
+    std::size_t jobs = parallel_for(js, std::size_t{0}, data.size(), std::size_t{1000},
+                                    [&](std::size_t i) { data[i] = 1; });
+    EXPECT_EQ(jobs, 0u);
+    for (int v : data) {
+        EXPECT_EQ(v, 1);
+    }
+}
+
+TEST(ParallelFor, VisitsEveryIndexExactlyOnce) {
+    constexpr std::size_t N = 100000;
+    JobSystem js(4);
+
+    auto visits = std::make_unique<std::atomic<int>[]>(N);
+    parallel_for(js, std::size_t{0}, N, std::size_t{64}, [&](std::size_t i) {
+        visits[i].fetch_add(1, std::memory_order_relaxed);
+    });
+
+    int wrong = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        if (visits[i].load() != 1) {
+            ++wrong;
+        }
+    }
+    EXPECT_EQ(wrong, 0);
+}
+
+TEST(ParallelFor, SignedIndexRange) {
+    JobSystem js(2);
+    std::atomic<long long> sum{0};
+    parallel_for(js, -500, 500, 16, [&](int i) {
+        sum.fetch_add(i, std::memory_order_relaxed);
+    });
+    EXPECT_EQ(sum.load(), -500);  // -500 + (-499 .. 499) 합 = -500
+}
+
+TEST(ParallelFor, JobCountDoesNotScaleWithIterations) {
+    // 반복 1M, grain 1 이어도 Job 수는 반복 수보다 훨씬 적어야 함
+    constexpr std::size_t N = 1000000;
+    JobSystem js(4);
+
+    std::vector<std::uint32_t> data(N, 1);
+    std::size_t jobs = parallel_for(js, std::size_t{0}, N, std::size_t{1}, [&](std::size_t i) {
+        data[i] *= 3;
+    });
+
+    std::cout << "[  INFO    ] parallel_for(1M, grain 1) spawned " << jobs << " jobs\n";
+    EXPECT_LT(jobs, N / 100);
+    for (std::size_t i = 0; i < N; i += 9973) {
+        EXPECT_EQ(data[i], 3u);
+    }
+    EXPECT_EQ(js.overflow_count(), 0u);
+}
+
+TEST(ParallelFor, WorkStealingMode) {
+    constexpr std::size_t N = 200000;
+    JobSystem js(4, SchedulerMode::WorkStealing);
+
+    std::atomic<long long> sum{0};
+    parallel_for(js, std::size_t{0}, N, std::size_t{256}, [&](std::size_t i) {
+        sum.fetch_add(static_cast<long long>(i), std::memory_order_relaxed);
+    });
+    EXPECT_EQ(sum.load(), static_cast<long long>(N - 1) * N / 2);
+}
+
+TEST(ParallelFor, NestedInsideJob) {
+    // 워커 안에서 다시 parallel_for → 기다리는 동안 다른 Job을 실행하므로 교착 없음
+    JobSystem js(2, SchedulerMode::WorkStealing);
+    std::atomic<int> count{0};
+
+    parallel_for(js, 0, 8, 1, [&](int) {
+        parallel_for(js, 0, 1000, 32, [&](int) {
+            count.fetch_add(1, std::memory_order_relaxed);
+        });
+    });
+    EXPECT_EQ(count.load(), 8000);
+}
+
+TEST(ParallelFor, RejectPolicyFallsBackToInline) {
+    JobSystem js(1, SchedulerMode::SharedQueue, OverflowPolicy::Reject);
+    std::atomic<long long> sum{0};
+    parallel_for(js, 0, 100000, 8, [&](int i) {
+        sum.fetch_add(i, std::memory_order_relaxed);
+    });
+    EXPECT_EQ(sum.load(), 99999LL * 100000 / 2);
+}
+
+// 본문은 여러 스레드에서 동시에 호출 → const 호출 가능한 본문만 받음
+template <typename F>
+concept AcceptedByParallelFor = requires(JobSystem& js, F& f) {
+    parallel_for(js, 0, 1, 1, f);
+};
+
+namespace {
+auto const_body = [](int) {};
+auto mutable_body = [calls = 0](int) mutable { ++calls; };
+}
+
+static_assert(AcceptedByParallelFor<decltype(const_body)>);
+static_assert(!AcceptedByParallelFor<decltype(mutable_body)>,
+              "mutable body must be rejected by the constraint, not inside parallel_for");
+
+// ========================================
+// parallel_reduce
+// ========================================
+
+TEST(ParallelReduce, EmptyRangeReturnsIdentity) {
+    JobSystem js(2);
+    int result = parallel_reduce(js, 10, 10, 1, 42,
+        [](int acc, int i) { return acc + i; }, std::plus<>{});
+    EXPECT_EQ(result, 42);
+}
+
+TEST(ParallelReduce, SumMatchesStdReduce) {
+    constexpr std::size_t N = 1 << 20;
+    JobSystem js(4);
+
+    std::vector<std::uint32_t> data(N);
+    std::mt19937 rng(7);
+    for (auto& v : data) {
+        v = rng() % 1000;
+    }
+
+    auto sum = parallel_reduce(js, std::size_t{0}, N, std::size_t{1024}, std::uint64_t{0},
+        [&](std::uint64_t acc, std::size_t i) { return acc + data[i]; },
+        std::plus<>{});
+    EXPECT_EQ(sum, std::reduce(data.begin(), data.end(), std::uint64_t{0}));
+}
+
+TEST(ParallelReduce, NonCommutativeCombineKeepsOrder) {
+    // 문자열 이어붙이기: 결합법칙만 성립 → 조각 순서가 지켜져야 같은 결과
+    constexpr int N = 5000;
+    JobSystem js(4, SchedulerMode::WorkStealing);
+
+    std::string expected;
+    for (int i = 0; i < N; ++i) {
+        expected += static_cast<char>('a' + i % 26);
+    }
+
+    std::string result = parallel_reduce(js, 0, N, 16, std::string{},
+        [](std::string acc, int i) {
+            acc += static_cast<char>('a' + i % 26);
+            return acc;
+        },
+        [](std::string left, const std::string& right) { return left + right; });
+    EXPECT_EQ(result, expected);
+}
+
+TEST(ParallelReduce, Histogram) {
+    constexpr std::size_t N = 200000;
+    constexpr std::size_t BUCKETS = 16;
+    JobSystem js(4);
+
+    std::vector<std::uint8_t> data(N);
+    std::vector<std::size_t> expected(BUCKETS, 0);
+    for (std::size_t i = 0; i < N; ++i) {
+        data[i] = static_cast<std::uint8_t>((i * 2654435761u) >> 7);
+        ++expected[data[i] % BUCKETS];
+    }
+
+    using Histogram = std::vector<std::size_t>;
+    Histogram hist = parallel_reduce(js, std::size_t{0}, N, std::size_t{4096}, Histogram(BUCKETS, 0),
+        [&](Histogram acc, std::size_t i) {
+            ++acc[data[i] % BUCKETS];
+            return acc;
+        },
+        [](Histogram left, const Histogram& right) {
+            for (std::size_t b = 0; b < BUCKETS; ++b) {
+                left[b] += right[b];
+            }
+            return left;
+        });
+    EXPECT_EQ(hist, expected);
+}
+
+TEST(ParallelReduce, NestedInsideJob) {
+    JobSystem js(2, SchedulerMode::WorkStealing);
+    long long total = parallel_reduce(js, 0, 8, 1, 0LL,
+        [&](long long acc, int) {
+            return acc + parallel_reduce(js, 0, 1000, 16, 0LL,
+                [](long long inner, int i) { return inner + i; }, std::plus<>{});
+        },
+        std::plus<>{});
+    EXPECT_EQ(total, 8LL * 999 * 1000 / 2);
+    js.wait_all();
+    EXPECT_EQ(js.pending_jobs(), 0u);
+}
+
+TEST(ParallelReduce, RejectPolicyFallsBackToInline) {
+    JobSystem js(1, SchedulerMode::SharedQueue, OverflowPolicy::Reject);
+    long long sum = parallel_reduce(js, 0, 100000, 8, 0LL,
+        [](long long acc, int i) { return acc + i; }, std::plus<>{});
+    EXPECT_EQ(sum, 99999LL * 100000 / 2);
+}
+
+// ========================================
+// parallel_inclusive_scan
+// ========================================
+
+TEST(ParallelScan, MatchesStdInclusiveScan) {
+    JobSystem js(4);
+    std::mt19937 rng(11);
+
+    // 조각 하나 / 조각 경계 근처 / 큰 입력
+    for (std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{7}, std::size_t{100},
+                          std::size_t{1023}, std::size_t{1024}, std::size_t{1025},
+                          std::size_t{300001}}) {
+        std::vector<std::uint64_t> in(n);
+        for (auto& v : in) {
+            v = rng() % 100;
+        }
+        std::vector<std::uint64_t> expected(n);
+        std::inclusive_scan(in.begin(), in.end(), expected.begin());
+
+        std::vector<std::uint64_t> out(n, 0);
+        auto out_end = parallel_inclusive_scan(js, in.begin(), in.end(), out.begin(),
+                                               std::plus<>{}, 64);
+        EXPECT_EQ(out_end, out.end()) << "n=" << n;
+        EXPECT_EQ(out, expected) << "n=" << n;
+    }
+}
+
+TEST(ParallelScan, InPlace) {
+    constexpr std::size_t N = 100000;
+    JobSystem js(4, SchedulerMode::WorkStealing);
+
+    std::vector<long long> data(N);
+    std::iota(data.begin(), data.end(), 1);
+    parallel_inclusive_scan(js, data.begin(), data.end(), data.begin(), std::plus<>{}, 256);
+
+    for (std::size_t i = 0; i < N; i += 997) {
+        long long k = static_cast<long long>(i) + 1;
+        EXPECT_EQ(data[i], k * (k + 1) / 2);
+    }
+    EXPECT_EQ(data.back(), static_cast<long long>(N) * (N + 1) / 2);
+}
+
+TEST(ParallelScan, NonCommutativeOp) {
+    // 2x2 행렬 곱 (mod 2^64, 부호 없는 오버플로는 정의됨): 결합법칙만 성립
+    struct Mat {
+        std::uint64_t a, b, c, d;
+        bool operator==(const Mat&) const = default;
+    };
+    auto mul = [](const Mat& x, const Mat& y) {
+        return Mat{x.a * y.a + x.b * y.c, x.a * y.b + x.b * y.d,
+                   x.c * y.a + x.d * y.c, x.c * y.b + x.d * y.d};
+    };
+
+    constexpr std::size_t N = 20000;
+    JobSystem js(3);
+
+    // 단위행렬과 치환행렬을 섞어서 결과가 순서에 의존하도록
+    std::vector<Mat> in(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        in[i] = (i % 3 == 0) ? Mat{0, 1, 1, 0} : (i % 3 == 1 ? Mat{1, 1, 0, 1} : Mat{1, 0, 1, 1});
+    }
+    std::vector<Mat> expected(N);
+    std::inclusive_scan(in.begin(), in.end(), expected.begin(), mul);
+
+    std::vector<Mat> out(N);
+    parallel_inclusive_scan(js, in.begin(), in.end(), out.begin(), mul, 32);
+    EXPECT_TRUE(out == expected);
+}
+
+// ========================================
+// parallel_sort
+// ========================================
+
+namespace {
+
+template <typename T>
+std::vector<T> random_values(std::size_t n, std::uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<T> values(n);
+    for (auto& v : values) {
+        v = static_cast<T>(rng());
+    }
+    return values;
+}
+
+template <typename T, typename Compare = std::less<>>
+void expect_sorts_like_std(JobSystem& js, std::vector<T> values, Compare comp = {}) {
+    std::vector<T> expected = values;
+    std::sort(expected.begin(), expected.end(), comp);
+    parallel_sort(js, values.begin(), values.end(), comp);
+    EXPECT_TRUE(values == expected) << "n=" << values.size();
+}
+
+} // namespace
+
+TEST(ParallelSort, RadixUnsigned) {
+    JobSystem js(4);
+    for (std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{1000},
+                          std::size_t{1} << 15, std::size_t{300007}}) {
+        expect_sorts_like_std(js, random_values<std::uint64_t>(n, n));
+        expect_sorts_like_std(js, random_values<std::uint32_t>(n, n + 1));
+    }
+}
+
+TEST(ParallelSort, RadixSignedAndNarrowTypes) {
+    JobSystem js(4, SchedulerMode::WorkStealing);
+    constexpr std::size_t N = 200000;
+    expect_sorts_like_std(js, random_values<std::int64_t>(N, 1));
+    expect_sorts_like_std(js, random_values<std::int32_t>(N, 2));
+    expect_sorts_like_std(js, random_values<std::int16_t>(N, 3));
+    expect_sorts_like_std(js, random_values<std::uint8_t>(N, 4));
+    expect_sorts_like_std(js, random_values<std::int8_t>(N, 5));
+}
+
+TEST(ParallelSort, RadixNarrowValueRange) {
+    // 상위 자릿수가 모두 같음 → 해당 패스는 건너뛰고 결과는 그대로 정렬됨
+    JobSystem js(4);
+    auto values = random_values<std::uint64_t>(100000, 9);
+    for (auto& v : values) {
+        v %= 1000;
+    }
+    expect_sorts_like_std(js, values);
+}
+
+TEST(ParallelSort, SampleSortWithComparator) {
+    JobSystem js(4);
+    constexpr std::size_t N = 200000;
+
+    // std::greater → 기수 정렬 경로가 아님
+    expect_sorts_like_std(js, random_values<std::uint32_t>(N, 21), std::greater<>{});
+
+    std::vector<double> doubles(N);
+    std::mt19937_64 rng(22);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    for (auto& d : doubles) {
+        d = dist(rng);
+    }
+    expect_sorts_like_std(js, doubles);
+}
+
+TEST(ParallelSort, SampleSortStrings) {
+    JobSystem js(4, SchedulerMode::WorkStealing);
+    constexpr std::size_t N = 50000;
+
+    std::vector<std::string> words(N);
+    std::mt19937 rng(31);
+    for (auto& w : words) {
+        w.resize(1 + rng() % 12);
+        for (auto& ch : w) {
+            ch = static_cast<char>('a' + rng() % 26);
+        }
+    }
+    expect_sorts_like_std(js, words);
+}
+
+TEST(ParallelSort, SampleSortSkewedInputs) {
+    JobSystem js(4);
+    constexpr std::size_t N = 100000;
+
+    // 모두 같은 키 / 이미 정렬됨 / 역순
+    expect_sorts_like_std(js, std::vector<double>(N, 3.0));
+
+    std::vector<double> ascending(N);
+    std::iota(ascending.begin(), ascending.end(), 0.0);
+    expect_sorts_like_std(js, ascending);
+
+    std::vector<double> descending(ascending.rbegin(), ascending.rend());
+    expect_sorts_like_std(js, descending);
+}
+
+TEST(ParallelSort, RecordsByKey) {
+    struct Record {
+        std::uint32_t key;
+        std::uint32_t payload;
+    };
+    JobSystem js(4);
+    constexpr std::size_t N = 100000;
+
+    std::vector<Record> records(N);
+    std::mt19937 rng(41);
+    for (std::size_t i = 0; i < N; ++i) {
+        records[i] = Record{static_cast<std::uint32_t>(rng() % 5000), static_cast<std::uint32_t>(i)};
+    }
+    parallel_sort(js, records.begin(), records.end(),
+                  [](const Record& a, const Record& b) { return a.key < b.key; });
+
+    EXPECT_TRUE(std::is_sorted(records.begin(), records.end(),
+                               [](const Record& a, const Record& b) { return a.key < b.key; }));
+    // 원소가 사라지거나 중복되지 않음
+    std::vector<bool> seen(N, false);
+    for (const auto& r : records) {
+        ASSERT_LT(r.payload, N);
+        EXPECT_FALSE(seen[r.payload]);
+        seen[r.payload] = true;
+    }
+}
+
+TEST(ParallelSort, MoveOnlyFallsBackToStdSort) {
+    // 샘플 정렬은 경계값을 복사 → move-only 원소는 std::sort 경로
+    JobSystem js(4);
+    constexpr int N = 50000;
+
+    std::vector<std::unique_ptr<int>> values;
+    values.reserve(N);
+    std::mt19937 rng(61);
+    for (int i = 0; i < N; ++i) {
+        values.push_back(std::make_unique<int>(static_cast<int>(rng() % 100000)));
+    }
+
+    parallel_sort(js, values.begin(), values.end(),
+                  [](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a < *b; });
+
+    ASSERT_EQ(values.size(), static_cast<std::size_t>(N));
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end(),
+                               [](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) { return *a < *b; }));
+    EXPECT_TRUE(std::none_of(values.begin(), values.end(),
+                             [](const std::unique_ptr<int>& p) { return p == nullptr; }));
+}
+
+TEST(ParallelSort, RejectPolicyFallsBackToInline) {
+    JobSystem js(1, SchedulerMode::SharedQueue, OverflowPolicy::Reject);
+    expect_sorts_like_std(js, random_values<std::uint64_t>(100000, 51));
+    expect_sorts_like_std(js, random_values<std::uint64_t>(100000, 52), std::greater<>{});
+}
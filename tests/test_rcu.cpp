@@ -0,0 +1,212 @@
+/**
+ * RCU Test Suite
+ *
+ * Tests for RcuPtr reads/updates, QSBR grace periods and batched call_rcu
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include "lockfree/rcu.hpp"
+
+using lockfree::RcuDomain;
+using lockfree::RcuPtr;
+using lockfree::RcuReader;
+
+namespace {
+
+struct Config {
+    explicit Config(int v) : version(v), checksum(v * 3) {}
+    int version;
+    int checksum;
+    std::atomic<bool> retired{false};
+};
+
+/**
+ * 해제하지 않고 "해제됨" 표시만 하는 deleter
+ *
+ * grace period 전에 호출되면 reader가 retired 표시를 보고 검출할 수 있음
+ * (실제 메모리는 테스트 끝에 한꺼번에 해제)
+ */
+struct Graveyard {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Config>> configs;
+    std::atomic<int> count{0};
+};
+
+struct MarkRetired {
+    Graveyard* graveyard = nullptr;
+
+    void operator()(Config* config) const {
+        config->retired.store(true, std::memory_order_relaxed);
+        graveyard->count.fetch_add(1, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> guard(graveyard->mutex);
+        graveyard->configs.emplace_back(config);
+    }
+};
+
+using TrackedPtr = RcuPtr<Config, MarkRetired>;
+
+std::unique_ptr<Config, MarkRetired> make_config(int version, Graveyard& graveyard) {
+    return std::unique_ptr<Config, MarkRetired>(new Config(version), MarkRetired{&graveyard});
+}
+
+} // namespace
+
+// ============================================
+// Basic Functionality Tests
+// ============================================
+
+TEST(RcuTest, ReadSeesLatestUpdate) {
+    RcuDomain domain;
+    RcuPtr<int> ptr(std::make_unique<int>(1), domain);
+    EXPECT_EQ(*ptr.read(), 1);
+
+    ptr.update(std::make_unique<int>(2));
+    EXPECT_EQ(*ptr.read(), 2);
+
+    ptr.update_sync(std::make_unique<int>(3));
+    EXPECT_EQ(*ptr.read(), 3);
+    domain.barrier();
+}
+
+TEST(RcuTest, SynchronizeWithoutReadersReturnsImmediately) {
+    RcuDomain domain;
+    domain.synchronize();
+    domain.synchronize();
+    EXPECT_EQ(domain.grace_period_count(), 2u);
+}
+
+TEST(RcuTest, OfflineReaderDoesNotBlockSynchronize) {
+    RcuDomain domain;
+    RcuReader reader(domain);
+    EXPECT_TRUE(reader.is_online());
+
+    reader.offline();
+    EXPECT_FALSE(reader.is_online());
+    domain.synchronize();  // 자기 자신이 online이면 여기서 교착
+
+    reader.online();
+    EXPECT_TRUE(reader.is_online());
+    reader.offline();
+}
+
+TEST(RcuTest, UpdateWaitsForOnlineReader) {
+    Graveyard graveyard;
+    RcuDomain domain;
+    TrackedPtr ptr(make_config(1, graveyard), domain);
+
+    std::atomic<bool> holding{false};
+    std::atomic<bool> release{false};
+    std::atomic<bool> saw_retired{false};
+
+    std::thread reader_thread([&]() {
+        RcuReader reader(domain);
+        const Config* config = ptr.read();
+        holding.store(true);
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+        // quiescent_state 전까지는 옛 객체가 살아 있어야 함
+        if (config->retired.load()) {
+            saw_retired.store(true);
+        }
+        reader.quiescent_state();
+    });
+
+    while (!holding.load()) {
+        std::this_thread::yield();
+    }
+
+    ptr.update(make_config(2, graveyard));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(graveyard.count.load(), 0) << "reclaimed while a reader still holds it";
+
+    release.store(true);
+    reader_thread.join();
+    domain.barrier();
+
+    EXPECT_FALSE(saw_retired.load());
+    EXPECT_EQ(graveyard.count.load(), 1);
+}
+
+TEST(RcuTest, CallRcuBatchesCallbacks) {
+    RcuDomain domain;
+    constexpr int COUNT = 1000;
+    std::atomic<int> ran{0};
+
+    for (int i = 0; i < COUNT; ++i) {
+        domain.call_rcu([&]() { ran.fetch_add(1, std::memory_order_relaxed); });
+    }
+    domain.barrier();
+
+    EXPECT_EQ(ran.load(), COUNT);
+    // 콜백마다가 아니라 묶음마다 grace period 한 번
+    EXPECT_LT(domain.grace_period_count(), static_cast<std::uint64_t>(COUNT));
+}
+
+TEST(RcuTest, DestructorRunsPendingCallbacks) {
+    std::atomic<int> ran{0};
+    {
+        RcuDomain domain;
+        for (int i = 0; i < 10; ++i) {
+            domain.call_rcu([&]() { ran.fetch_add(1); });
+        }
+    }
+    EXPECT_EQ(ran.load(), 10);
+}
+
+// ============================================
+// Multithreaded Tests
+// ============================================
+
+TEST(RcuTest, ReadersNeverSeeReclaimedConfig) {
+    Graveyard graveyard;
+    RcuDomain domain;
+    TrackedPtr ptr(make_config(0, graveyard), domain);
+
+    constexpr int NUM_READERS = 4;
+    constexpr int NUM_UPDATES = 2000;
+    std::atomic<bool> stop{false};
+    std::atomic<bool> saw_retired{false};
+    std::atomic<bool> saw_torn{false};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < NUM_READERS; ++i) {
+        readers.emplace_back([&]() {
+            RcuReader reader(domain);
+            while (!stop.load(std::memory_order_relaxed)) {
+                const Config* config = ptr.read();
+                if (config->checksum != config->version * 3) {
+                    saw_torn.store(true, std::memory_order_relaxed);
+                }
+                if (config->retired.load(std::memory_order_relaxed)) {
+                    saw_retired.store(true, std::memory_order_relaxed);
+                }
+                reader.quiescent_state();
+            }
+        });
+    }
+
+    std::thread writer([&]() {
+        for (int i = 1; i <= NUM_UPDATES; ++i) {
+            ptr.update(make_config(i, graveyard));
+        }
+    });
+
+    writer.join();
+    domain.barrier();
+    stop.store(true);
+    for (auto& t : readers) {
+        t.join();
+    }
+
+    EXPECT_FALSE(saw_torn.load());
+    EXPECT_FALSE(saw_retired.load());
+    EXPECT_EQ(graveyard.count.load(), NUM_UPDATES);
+    EXPECT_EQ(ptr.read()->version, NUM_UPDATES);
+}
@@ -0,0 +1,166 @@
+/**
+ * SeqLock Test Suite
+ *
+ * Tests for sequence lock (read-mostly small structs)
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include "lockfree/seqlock.hpp"
+
+namespace {
+
+// 세 필드가 항상 같은 관계를 유지 → 찢어진 읽기(torn read) 검출용
+struct Quote {
+    std::uint64_t bid;
+    std::uint64_t ask;
+    std::uint64_t checksum;
+};
+
+Quote make_quote(std::uint64_t i) {
+    return Quote{i, i * 2 + 1, i ^ 0x5A5A5A5AULL};
+}
+
+bool is_consistent(const Quote& q) {
+    return q.ask == q.bid * 2 + 1 && q.checksum == (q.bid ^ 0x5A5A5A5AULL);
+}
+
+// 8바이트 배수가 아닌 크기
+struct Small {
+    std::uint32_t a;
+    std::uint32_t b;
+    std::uint16_t c;
+};
+
+} // namespace
+
+// ============================================
+// Basic Functionality Tests
+// ============================================
+
+TEST(SeqLockTest, DefaultValue) {
+    lockfree::SeqLock<Quote> lock;
+    Quote q = lock.load();
+    EXPECT_EQ(q.bid, 0u);
+    EXPECT_EQ(q.ask, 0u);
+    EXPECT_EQ(q.checksum, 0u);
+}
+
+TEST(SeqLockTest, StoreLoad) {
+    lockfree::SeqLock<Quote> lock(make_quote(1));
+    EXPECT_TRUE(is_consistent(lock.load()));
+
+    lock.store(make_quote(42));
+    Quote q = lock.load();
+    EXPECT_EQ(q.bid, 42u);
+    EXPECT_TRUE(is_consistent(q));
+}
+
+TEST(SeqLockTest, VersionAdvancesByTwo) {
+    lockfree::SeqLock<Quote> lock;
+    std::uint64_t v0 = lock.version();
+    EXPECT_EQ(v0 % 2, 0u);
+
+    lock.store(make_quote(7));
+    EXPECT_EQ(lock.version(), v0 + 2);
+}
+
+TEST(SeqLockTest, OddSizedType) {
+    lockfree::SeqLock<Small> lock;
+    lock.store(Small{1, 2, 3});
+    Small s = lock.load();
+    EXPECT_EQ(s.a, 1u);
+    EXPECT_EQ(s.b, 2u);
+    EXPECT_EQ(s.c, 3u);
+}
+
+TEST(SeqLockTest, Update) {
+    lockfree::SeqLock<Quote> lock(make_quote(10));
+    lock.update([](Quote& q) { q = make_quote(q.bid + 1); });
+    EXPECT_EQ(lock.load().bid, 11u);
+}
+
+// ============================================
+// Multithreaded Tests
+// ============================================
+
+TEST(SeqLockTest, SingleWriterNoTornReads) {
+    lockfree::SeqLock<Quote> lock(make_quote(0));
+    std::atomic<bool> stop{false};
+    std::atomic<bool> torn_read{false};
+    std::atomic<bool> went_backwards{false};
+    constexpr int NUM_READERS = 4;
+    constexpr std::uint64_t NUM_WRITES = 200000;
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < NUM_READERS; ++i) {
+        readers.emplace_back([&]() {
+            std::uint64_t last = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                Quote q = lock.load();
+                if (!is_consistent(q)) {
+                    torn_read.store(true, std::memory_order_relaxed);
+                }
+                // writer 하나 → 값은 단조 증가해야 함
+                if (q.bid < last) {
+                    went_backwards.store(true, std::memory_order_relaxed);
+                }
+                last = q.bid;
+            }
+        });
+    }
+
+    std::thread writer([&]() {
+        for (std::uint64_t i = 1; i <= NUM_WRITES; ++i) {
+            lock.store(make_quote(i));
+        }
+    });
+
+    writer.join();
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& t : readers) {
+        t.join();
+    }
+
+    EXPECT_FALSE(torn_read.load());
+    EXPECT_FALSE(went_backwards.load());
+    EXPECT_EQ(lock.load().bid, NUM_WRITES);
+}
+
+TEST(SeqLockTest, MultiWriterSerialized) {
+    lockfree::SeqLock<Quote, true> lock(make_quote(0));
+    std::atomic<bool> stop{false};
+    std::atomic<bool> torn_read{false};
+    constexpr int NUM_WRITERS = 4;
+    constexpr int UPDATES_PER_WRITER = 20000;
+
+    std::thread reader([&]() {
+        while (!stop.load(std::memory_order_relaxed)) {
+            if (!is_consistent(lock.load())) {
+                torn_read.store(true, std::memory_order_relaxed);
+            }
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (int i = 0; i < NUM_WRITERS; ++i) {
+        writers.emplace_back([&]() {
+            for (int j = 0; j < UPDATES_PER_WRITER; ++j) {
+                // 직렬화가 깨지면 증가분이 사라짐
+                lock.update([](Quote& q) { q = make_quote(q.bid + 1); });
+            }
+        });
+    }
+
+    for (auto& t : writers) {
+        t.join();
+    }
+    stop.store(true, std::memory_order_relaxed);
+    reader.join();
+
+    EXPECT_FALSE(torn_read.load());
+    EXPECT_EQ(lock.load().bid, static_cast<std::uint64_t>(NUM_WRITERS) * UPDATES_PER_WRITER);
+}
@@ -0,0 +1,214 @@
+/**
+ * SharedSpinLock Test Suite
+ *
+ * Tests for reader-writer spinlock with sharded reader counts
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include "lockfree/shared_spinlock.hpp"
+
+// ============================================
+// Basic Functionality Tests
+// ============================================
+
+TEST(SharedSpinLockTest, ExclusiveLockUnlock) {
+    lockfree::SharedSpinLock lock;
+    lock.lock();
+    EXPECT_FALSE(lock.try_lock_shared());
+    lock.unlock();
+    EXPECT_TRUE(lock.try_lock_shared());
+    lock.unlock_shared();
+}
+
+TEST(SharedSpinLockTest, MultipleReaders) {
+    lockfree::SharedSpinLock lock;
+    lock.lock_shared();
+
+    // 다른 스레드도 동시에 읽기 락을 잡을 수 있어야 함
+    std::atomic<bool> second_reader{false};
+    std::thread t([&]() {
+        second_reader = lock.try_lock_shared();
+        if (second_reader) {
+            lock.unlock_shared();
+        }
+    });
+    t.join();
+
+    EXPECT_TRUE(second_reader);
+    lock.unlock_shared();
+}
+
+TEST(SharedSpinLockTest, ReaderBlocksWriter) {
+    lockfree::SharedSpinLock lock;
+    lock.lock_shared();
+
+    std::atomic<bool> writer_result{true};
+    std::thread t([&]() {
+        writer_result = lock.try_lock();
+    });
+    t.join();
+
+    EXPECT_FALSE(writer_result);
+    lock.unlock_shared();
+    EXPECT_TRUE(lock.try_lock());
+    lock.unlock();
+}
+
+TEST(SharedSpinLockTest, StdLockAdapters) {
+    // std::shared_mutex와 같은 SharedLockable 인터페이스
+    lockfree::SharedSpinLock lock;
+    {
+        std::shared_lock<lockfree::SharedSpinLock> reader(lock);
+        EXPECT_TRUE(reader.owns_lock());
+    }
+    {
+        std::unique_lock<lockfree::SharedSpinLock> writer(lock);
+        EXPECT_TRUE(writer.owns_lock());
+    }
+    EXPECT_TRUE(lock.try_lock());
+    lock.unlock();
+}
+
+// ============================================
+// Writer Preference Tests
+// ============================================
+
+TEST(SharedSpinLockTest, WaitingWriterBlocksNewReaders) {
+    lockfree::SharedSpinLock lock;
+    lock.lock_shared();
+
+    std::atomic<bool> writer_acquired{false};
+    std::thread writer([&]() {
+        lock.lock();
+        writer_acquired = true;
+        lock.unlock();
+    });
+
+    // writer가 도착할 때까지 기다림 (try_lock_shared가 실패하기 시작)
+    bool blocked = false;
+    for (int i = 0; i < 100000 && !blocked; ++i) {
+        std::thread probe([&]() {
+            if (lock.try_lock_shared()) {
+                lock.unlock_shared();
+            } else {
+                blocked = true;
+            }
+        });
+        probe.join();
+    }
+
+    EXPECT_TRUE(blocked) << "new readers must back off while a writer waits";
+    EXPECT_FALSE(writer_acquired);
+
+    lock.unlock_shared();
+    writer.join();
+    EXPECT_TRUE(writer_acquired);
+}
+
+TEST(SharedSpinLockTest, WriterNotStarvedByReaders) {
+    lockfree::SharedSpinLock lock;
+    std::atomic<bool> stop{false};
+    constexpr int NUM_READERS = 4;
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < NUM_READERS; ++i) {
+        readers.emplace_back([&]() {
+            while (!stop.load(std::memory_order_relaxed)) {
+                std::shared_lock<lockfree::SharedSpinLock> guard(lock);
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    // 읽기가 끊임없이 들어와도 writer는 진입할 수 있어야 함
+    for (int i = 0; i < 100; ++i) {
+        std::unique_lock<lockfree::SharedSpinLock> guard(lock);
+    }
+
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& t : readers) {
+        t.join();
+    }
+    SUCCEED();
+}
+
+// ============================================
+// Multithreaded Tests
+// ============================================
+
+TEST(SharedSpinLockTest, ReadersSeeConsistentData) {
+    lockfree::SharedSpinLock lock;
+    // writer는 두 값을 항상 같게 유지 → reader가 다르게 보면 위반
+    long long a = 0;
+    long long b = 0;
+    std::atomic<bool> violation_detected{false};
+    std::atomic<bool> stop{false};
+    constexpr int NUM_READERS = 6;
+    constexpr int NUM_WRITERS = 2;
+    constexpr int WRITES_PER_WRITER = 10000;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_READERS; ++i) {
+        threads.emplace_back([&]() {
+            while (!stop.load(std::memory_order_relaxed)) {
+                std::shared_lock<lockfree::SharedSpinLock> guard(lock);
+                if (a != b) {
+                    violation_detected.store(true, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (int i = 0; i < NUM_WRITERS; ++i) {
+        writers.emplace_back([&]() {
+            for (int j = 0; j < WRITES_PER_WRITER; ++j) {
+                std::unique_lock<lockfree::SharedSpinLock> guard(lock);
+                ++a;
+                ++b;
+            }
+        });
+    }
+
+    for (auto& t : writers) {
+        t.join();
+    }
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_FALSE(violation_detected.load());
+    EXPECT_EQ(a, static_cast<long long>(NUM_WRITERS) * WRITES_PER_WRITER);
+    EXPECT_EQ(b, a);
+}
+
+TEST(SharedSpinLockTest, WriterMutualExclusion) {
+    lockfree::SharedSpinLock lock;
+    long long counter = 0;
+    constexpr int NUM_THREADS = 8;
+    constexpr int ITERATIONS = 20000;
+
+    std::vector<std::thread> threads;
+    threads.reserve(NUM_THREADS);
+
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&lock, &counter]() {
+            for (int j = 0; j < ITERATIONS; ++j) {
+                std::unique_lock<lockfree::SharedSpinLock> guard(lock);
+                ++counter;
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(counter, static_cast<long long>(NUM_THREADS) * ITERATIONS);
+}
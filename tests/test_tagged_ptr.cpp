@@ -0,0 +1,142 @@
+/**
+ * Tagged Pointer Test Suite
+ *
+ * Tests for the packed (48+16) and wide (128-bit CAS) AtomicTaggedPtr backends
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include "lockfree/tagged_ptr.hpp"
+
+using lockfree::TaggedPtr;
+using lockfree::PackedAtomicTaggedPtr;
+
+// ============================================
+// 두 저장 방식에 공통인 동작 (Typed Test)
+// ============================================
+
+template <typename Atomic>
+class AtomicTaggedPtrTest : public ::testing::Test {};
+
+#if LOCKFREE_HAS_DWCAS
+using Backends = ::testing::Types<PackedAtomicTaggedPtr<int>, lockfree::WideAtomicTaggedPtr<int>>;
+#else
+using Backends = ::testing::Types<PackedAtomicTaggedPtr<int>>;
+#endif
+TYPED_TEST_SUITE(AtomicTaggedPtrTest, Backends);
+
+TYPED_TEST(AtomicTaggedPtrTest, DefaultIsNullWithZeroTag) {
+    TypeParam head;
+    TaggedPtr<int> value = head.load();
+    EXPECT_EQ(value.ptr(), nullptr);
+    EXPECT_EQ(value.tag(), 0u);
+    EXPECT_TRUE(TypeParam::is_always_lock_free);
+    EXPECT_TRUE(head.is_lock_free());
+}
+
+TYPED_TEST(AtomicTaggedPtrTest, LoadStoreRoundTrip) {
+    int x = 0;
+    TypeParam head(TaggedPtr<int>(&x, 5));
+    EXPECT_EQ(head.load(), TaggedPtr<int>(&x, 5));
+
+    int y = 0;
+    head.store(TaggedPtr<int>(&y, 6));
+    EXPECT_EQ(head.load().ptr(), &y);
+    EXPECT_EQ(head.load().tag(), 6u);
+}
+
+TYPED_TEST(AtomicTaggedPtrTest, CompareExchangeChecksTag) {
+    int x = 0;
+    TypeParam head(TaggedPtr<int>(&x, 1));
+
+    // 포인터는 같지만 태그가 다름 → ABA로 보고 실패, expected는 현재 값으로 갱신
+    TaggedPtr<int> stale(&x, 0);
+    EXPECT_FALSE(head.compare_exchange_strong(
+        stale, stale.advanced(nullptr),
+        std::memory_order_acq_rel, std::memory_order_acquire));
+    EXPECT_EQ(stale, TaggedPtr<int>(&x, 1));
+
+    EXPECT_TRUE(head.compare_exchange_strong(
+        stale, stale.advanced(nullptr),
+        std::memory_order_acq_rel, std::memory_order_acquire));
+    EXPECT_EQ(head.load(), TaggedPtr<int>(nullptr, 2));
+}
+
+TYPED_TEST(AtomicTaggedPtrTest, ConcurrentAdvanceCountsEveryUpdate) {
+    int x = 0;
+    TypeParam head(TaggedPtr<int>(&x, 0));
+    constexpr int NUM_THREADS = 4;
+    constexpr int ITERATIONS = 10000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < ITERATIONS; ++i) {
+                TaggedPtr<int> old = head.load(std::memory_order_relaxed);
+                while (!head.compare_exchange_weak(
+                    old, old.advanced(&x),
+                    std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    // 40000 < 65536 → packed 방식도 wrap 전
+    EXPECT_EQ(head.load().tag(), static_cast<std::uint64_t>(NUM_THREADS * ITERATIONS));
+    EXPECT_EQ(head.load().ptr(), &x);
+}
+
+// ============================================
+// 방식별 차이
+// ============================================
+
+TEST(TaggedPtrTest, PackedTagWrapsAfter16Bits) {
+    int x = 0;
+    PackedAtomicTaggedPtr<int> head(TaggedPtr<int>(&x, 0xFFFF));
+    TaggedPtr<int> old = head.load();
+    ASSERT_TRUE(head.compare_exchange_strong(
+        old, old.advanced(&x),
+        std::memory_order_acq_rel, std::memory_order_relaxed));
+    EXPECT_EQ(head.load().tag(), 0u) << "16-bit tag wraps";
+    EXPECT_EQ(head.load().ptr(), &x);
+}
+
+#if LOCKFREE_HAS_DWCAS
+TEST(TaggedPtrTest, WideTagDoesNotWrap) {
+    int x = 0;
+    lockfree::WideAtomicTaggedPtr<int> head(TaggedPtr<int>(&x, 0xFFFF));
+    TaggedPtr<int> old = head.load();
+    ASSERT_TRUE(head.compare_exchange_strong(
+        old, old.advanced(&x),
+        std::memory_order_acq_rel, std::memory_order_relaxed));
+    EXPECT_EQ(head.load().tag(), 0x10000u);
+    EXPECT_EQ(sizeof(head), 16u);
+}
+
+TEST(TaggedPtrTest, WideAcceptsAddressesAbove48Bits) {
+    // LA57 커널의 사용자 주소 흉내 (역참조하지 않음)
+    auto* high = reinterpret_cast<int*>(std::uintptr_t{1} << 52);
+    lockfree::WideAtomicTaggedPtr<int> head(TaggedPtr<int>(high, 7));
+    EXPECT_EQ(head.load().ptr(), high);
+    EXPECT_EQ(head.load().tag(), 7u);
+}
+
+TEST(TaggedPtrTest, WideIsSelectedWhenAvailable) {
+    EXPECT_TRUE((std::is_same_v<lockfree::AtomicTaggedPtr<int>, lockfree::WideAtomicTaggedPtr<int>>));
+}
+#endif
+
+TEST(TaggedPtrDeathTest, PackedRejectsAddressesAbove48Bits) {
+    auto* high = reinterpret_cast<int*>(std::uintptr_t{1} << 52);
+    EXPECT_DEATH({
+        PackedAtomicTaggedPtr<int> head(TaggedPtr<int>(high, 0));
+        (void)head.load();
+    }, "does not fit in 48 bits");
+}
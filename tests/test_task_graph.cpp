@@ -0,0 +1,328 @@
+/**
+ * Task Graph 테스트
+ *
+ * JobSystem 위의 DAG 실행: 의존성 순서, 다시 실행, 순환 검사, 할당 없음
+ */
+
+#include <gtest/gtest.h>
+#include <lockfree/task_graph.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <random>
+#include <vector>
+
+// ============================================
+// 전역 new 횟수 세기 (이 테스트 바이너리 전용)
+// ============================================
+
+namespace {
+std::atomic<std::size_t> g_allocations{0};
+}
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+// GCC는 인라인된 delete 안의 free를 new와 짝이 안 맞는다고 오탐 (위 new는 malloc 사용)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+using namespace lockfree;
+
+namespace {
+
+/**
+ * 간선마다 "from이 끝난 뒤에 to가 시작했는지" 검사하는 그래프
+ *
+ * 노드마다 완료 세대(generation)를 기록 → 여러 번 run해도 이번 실행 기준으로 검사
+ */
+struct CheckedGraph {
+    explicit CheckedGraph(std::size_t nodes)
+        : finished(std::make_unique<std::atomic<int>[]>(nodes)),
+          predecessors(nodes) {
+        for (std::size_t i = 0; i < nodes; ++i) {
+            finished[i].store(0);
+            graph.add_node([this, i]() {
+                for (std::size_t pred : predecessors[i]) {
+                    if (finished[pred].load(std::memory_order_relaxed) != generation) {
+                        violations.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                executed.fetch_add(1, std::memory_order_relaxed);
+                finished[i].store(generation, std::memory_order_relaxed);
+            });
+        }
+    }
+
+    void add_edge(std::size_t from, std::size_t to) {
+        graph.add_edge(from, to);
+        predecessors[to].push_back(from);
+    }
+
+    bool run(JobSystem& js) {
+        ++generation;
+        return graph.run(js);
+    }
+
+    TaskGraph graph;
+    std::unique_ptr<std::atomic<int>[]> finished;
+    std::vector<std::vector<std::size_t>> predecessors;
+    std::atomic<int> violations{0};
+    std::atomic<int> executed{0};
+    int generation = 0;
+};
+
+} // namespace
+
+// ========================================
+// 기본
+// ========================================
+
+TEST(TaskGraph, EmptyGraphRuns) {
+    JobSystem js(2);
+    TaskGraph graph;
+    EXPECT_TRUE(graph.run(js));
+    EXPECT_EQ(graph.node_count(), 0u);
+}
+
+TEST(TaskGraph, ChainRunsInOrder) {
+    constexpr int N = 50;
+    JobSystem js(4);
+
+    std::vector<int> order;
+    order.reserve(N);
+    TaskGraph graph;
+    for (int i = 0; i < N; ++i) {
+        graph.add_node([&order, i]() { order.push_back(i); });
+        if (i > 0) {
+            graph.add_edge(static_cast<TaskGraph::NodeId>(i - 1), static_cast<TaskGraph::NodeId>(i));
+        }
+    }
+    EXPECT_EQ(graph.edge_count(), static_cast<std::size_t>(N - 1));
+
+    // 사슬 → 한 번에 하나씩만 실행되므로 vector에 그냥 push해도 안전
+    ASSERT_TRUE(graph.run(js));
+    ASSERT_EQ(order.size(), static_cast<std::size_t>(N));
+    for (int i = 0; i < N; ++i) {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+TEST(TaskGraph, DiamondWaitsForBothBranches) {
+    //      ┌─► 1 ─┐
+    //  0 ──┤      ├─► 3
+    //      └─► 2 ─┘
+    JobSystem js(4);
+    CheckedGraph checked(4);
+    checked.add_edge(0, 1);
+    checked.add_edge(0, 2);
+    checked.add_edge(1, 3);
+    checked.add_edge(2, 3);
+
+    ASSERT_TRUE(checked.run(js));
+    EXPECT_EQ(checked.executed.load(), 4);
+    EXPECT_EQ(checked.violations.load(), 0);
+}
+
+TEST(TaskGraph, WideFanIn) {
+    constexpr std::size_t PREDECESSORS = 64;
+    JobSystem js(4, SchedulerMode::WorkStealing);
+
+    CheckedGraph checked(PREDECESSORS + 1);
+    for (std::size_t i = 0; i < PREDECESSORS; ++i) {
+        checked.add_edge(i, PREDECESSORS);
+    }
+
+    for (int round = 0; round < 20; ++round) {
+        ASSERT_TRUE(checked.run(js));
+    }
+    EXPECT_EQ(checked.executed.load(), static_cast<int>(20 * (PREDECESSORS + 1)));
+    EXPECT_EQ(checked.violations.load(), 0);
+}
+
+// ========================================
+// 무작위 DAG + 다시 실행
+// ========================================
+
+void run_random_dag(SchedulerMode mode) {
+    constexpr std::size_t NODES = 200;
+    constexpr int ROUNDS = 20;
+    JobSystem js(4, mode);
+
+    // i < j 인 간선만 → 항상 DAG
+    CheckedGraph checked(NODES);
+    std::mt19937 rng(2024);
+    for (std::size_t j = 1; j < NODES; ++j) {
+        std::size_t fan_in = rng() % 4;
+        for (std::size_t k = 0; k < fan_in; ++k) {
+            checked.add_edge(rng() % j, j);
+        }
+    }
+
+    for (int round = 0; round < ROUNDS; ++round) {
+        ASSERT_TRUE(checked.run(js));
+    }
+    EXPECT_EQ(checked.executed.load(), static_cast<int>(NODES) * ROUNDS);
+    EXPECT_EQ(checked.violations.load(), 0);
+    js.wait_all();
+    EXPECT_EQ(js.pending_jobs(), 0u);
+}
+
+TEST(TaskGraph, RandomDagSharedQueue) {
+    run_random_dag(SchedulerMode::SharedQueue);
+}
+
+TEST(TaskGraph, RandomDagWorkStealing) {
+    run_random_dag(SchedulerMode::WorkStealing);
+}
+
+TEST(TaskGraph, RerunDoesNotAllocate) {
+    JobSystem js(2, SchedulerMode::WorkStealing);
+    std::atomic<int> count{0};
+
+    TaskGraph graph;
+    std::vector<TaskGraph::NodeId> ids;
+    for (int i = 0; i < 32; ++i) {
+        ids.push_back(graph.add_node([&count]() { count.fetch_add(1, std::memory_order_relaxed); }));
+    }
+    for (int i = 1; i < 32; ++i) {
+        graph.add_edge(ids[static_cast<std::size_t>(i / 2)], ids[static_cast<std::size_t>(i)]);
+    }
+
+    ASSERT_TRUE(graph.run(js));  // 첫 실행: 순환 검사/시작 노드 목록 (할당 가능)
+
+    std::size_t before = g_allocations.load();
+    for (int round = 0; round < 10; ++round) {
+        ASSERT_TRUE(graph.run(js));
+    }
+    EXPECT_EQ(g_allocations.load() - before, 0u);
+    EXPECT_EQ(count.load(), 32 * 11);
+}
+
+// ========================================
+// 순환 / 그래프 변경
+// ========================================
+
+TEST(TaskGraph, CycleIsRejected) {
+    JobSystem js(2);
+    std::atomic<int> count{0};
+
+    TaskGraph graph;
+    auto a = graph.add_node([&count]() { count.fetch_add(1); });
+    auto b = graph.add_node([&count]() { count.fetch_add(1); });
+    auto c = graph.add_node([&count]() { count.fetch_add(1); });
+    graph.add_edge(a, b);
+    graph.add_edge(b, c);
+    EXPECT_TRUE(graph.is_acyclic());
+
+    graph.add_edge(c, b);
+    EXPECT_FALSE(graph.is_acyclic());
+    EXPECT_FALSE(graph.run(js));
+    EXPECT_EQ(count.load(), 0);
+}
+
+TEST(TaskGraph, GrowBetweenRuns) {
+    JobSystem js(2);
+    CheckedGraph checked(3);
+    checked.add_edge(0, 1);
+    ASSERT_TRUE(checked.run(js));
+    EXPECT_EQ(checked.executed.load(), 3);
+
+    checked.add_edge(1, 2);
+    ASSERT_TRUE(checked.run(js));
+    EXPECT_EQ(checked.executed.load(), 6);
+    EXPECT_EQ(checked.violations.load(), 0);
+}
+
+// ========================================
+// JobSystem 상호작용
+// ========================================
+
+TEST(TaskGraph, RunFromInsideJob) {
+    JobSystem js(2, SchedulerMode::WorkStealing);
+    CheckedGraph checked(16);
+    for (std::size_t i = 1; i < 16; ++i) {
+        checked.add_edge(i - 1, i);
+    }
+
+    Counter outer(0);
+    std::atomic<bool> ok{false};
+    js.schedule([&]() { ok = checked.run(js); }, &outer);
+    js.wait_for_counter(&outer);
+
+    EXPECT_TRUE(ok.load());
+    EXPECT_EQ(checked.executed.load(), 16);
+    EXPECT_EQ(checked.violations.load(), 0);
+}
+
+TEST(TaskGraph, RejectPolicyRunsInline) {
+    JobSystem js(1, SchedulerMode::SharedQueue, OverflowPolicy::Reject);
+    CheckedGraph checked(100);
+    for (std::size_t i = 1; i < 100; ++i) {
+        checked.add_edge(0, i);
+    }
+    ASSERT_TRUE(checked.run(js));
+    EXPECT_EQ(checked.executed.load(), 100);
+    EXPECT_EQ(checked.violations.load(), 0);
+}
+
+TEST(TaskGraph, RejectedLongChainRunsWithoutDeepRecursion) {
+    // 워커를 막고 공유 큐를 가득 채움 → 모든 노드 예약이 거부되어 호출자가 직접 실행
+    // 인라인 실행이 재귀면 사슬 길이만큼 스택이 깊어짐 (10만 단계 → 스택 넘침)
+    constexpr std::size_t CHAIN = 100000;
+    JobSystem js(1, SchedulerMode::SharedQueue, OverflowPolicy::Reject);
+
+    std::atomic<bool> worker_blocked{false};
+    std::atomic<bool> release{false};
+    js.schedule([&]() {
+        worker_blocked.store(true, std::memory_order_release);
+        while (!release.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    });
+    while (!worker_blocked.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+    while (js.schedule([]() {})) {
+    }
+
+    std::size_t expected_next = 0;
+    bool in_order = true;
+    TaskGraph graph;
+    for (std::size_t i = 0; i < CHAIN; ++i) {
+        graph.add_node([&expected_next, &in_order, i]() {
+            in_order = in_order && expected_next == i;
+            ++expected_next;
+        });
+        if (i > 0) {
+            graph.add_edge(i - 1, i);
+        }
+    }
+
+    EXPECT_TRUE(graph.run(js));
+    EXPECT_EQ(expected_next, CHAIN);
+    EXPECT_TRUE(in_order);
+
+    release.store(true, std::memory_order_release);
+    js.wait_all();
+}
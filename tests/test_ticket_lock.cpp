@@ -0,0 +1,202 @@
+/**
+ * Ticket Lock Test Suite
+ *
+ * Tests for fair FIFO ticket spinlock
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include "lockfree/ticket_lock.hpp"
+
+// ============================================
+// Basic Functionality Tests
+// ============================================
+
+TEST(TicketLockTest, LockUnlock) {
+    lockfree::TicketLock lock;
+    lock.lock();
+    EXPECT_TRUE(lock.is_locked());
+    lock.unlock();
+    EXPECT_FALSE(lock.is_locked());
+}
+
+TEST(TicketLockTest, TryLock) {
+    lockfree::TicketLock lock;
+    EXPECT_TRUE(lock.try_lock());
+
+    std::atomic<bool> try_lock_result{true};
+    std::thread t([&lock, &try_lock_result]() {
+        try_lock_result = lock.try_lock();
+    });
+    t.join();
+
+    EXPECT_FALSE(try_lock_result);
+    lock.unlock();
+    EXPECT_FALSE(lock.is_locked());
+}
+
+TEST(TicketLockTest, WaitingCount) {
+    lockfree::TicketLock lock;
+    lock.lock();
+    EXPECT_EQ(lock.waiting_count(), 0u);
+
+    std::thread waiter([&lock]() {
+        lock.lock();
+        lock.unlock();
+    });
+
+    while (lock.waiting_count() == 0) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(lock.waiting_count(), 1u);
+
+    lock.unlock();
+    waiter.join();
+    EXPECT_FALSE(lock.is_locked());
+}
+
+// ============================================
+// TicketLockGuard Tests
+// ============================================
+
+TEST(TicketLockGuardTest, ExceptionSafety) {
+    lockfree::TicketLock lock;
+    try {
+        lockfree::TicketLockGuard guard(lock);
+        throw std::runtime_error("test exception");
+    } catch (...) {
+        // Lock should be released even after exception
+    }
+    EXPECT_TRUE(lock.try_lock());
+    lock.unlock();
+}
+
+// ============================================
+// Fairness Tests
+// ============================================
+
+TEST(TicketLockTest, FIFOOrder) {
+    // 번호표를 뽑은 순서대로 획득해야 함
+    lockfree::TicketLock lock;
+    lock.lock();
+
+    constexpr int NUM_WAITERS = 4;
+    std::vector<int> order;
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < NUM_WAITERS; ++i) {
+        threads.emplace_back([&, i]() {
+            lock.lock();
+            order.push_back(i);
+            lock.unlock();
+        });
+        // 이 스레드가 번호표를 뽑을 때까지 기다린 후 다음 스레드 시작
+        while (lock.waiting_count() != static_cast<std::uint32_t>(i + 1)) {
+            std::this_thread::yield();
+        }
+    }
+
+    lock.unlock();
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    ASSERT_EQ(order.size(), static_cast<size_t>(NUM_WAITERS));
+    for (int i = 0; i < NUM_WAITERS; ++i) {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+TEST(TicketLockTest, NoStarvation) {
+    // 한 스레드가 lock/unlock을 반복해도 다른 스레드가 굶지 않아야 함
+    lockfree::TicketLock lock;
+    std::atomic<bool> stop{false};
+    std::atomic<int> greedy_count{0};
+
+    std::thread greedy([&]() {
+        while (!stop.load(std::memory_order_relaxed)) {
+            lockfree::TicketLockGuard guard(lock);
+            greedy_count.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    // greedy가 돌고 있는 중에도 제한 시간 안에 여러 번 획득해야 함
+    constexpr int ACQUISITIONS = 1000;
+    for (int i = 0; i < ACQUISITIONS; ++i) {
+        lockfree::TicketLockGuard guard(lock);
+    }
+
+    stop.store(true, std::memory_order_relaxed);
+    greedy.join();
+
+    EXPECT_FALSE(lock.is_locked());
+}
+
+// ============================================
+// Multithreaded Tests
+// ============================================
+
+TEST(TicketLockTest, MutualExclusion) {
+    lockfree::TicketLock lock;
+    std::atomic<int> in_critical_section{0};
+    std::atomic<bool> violation_detected{false};
+    constexpr int NUM_THREADS = 8;
+    constexpr int ITERATIONS = 1000;
+
+    std::vector<std::thread> threads;
+    threads.reserve(NUM_THREADS);
+
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < ITERATIONS; ++j) {
+                lock.lock();
+
+                int prev = in_critical_section.fetch_add(1, std::memory_order_relaxed);
+                if (prev != 0) {
+                    violation_detected.store(true, std::memory_order_relaxed);
+                }
+                std::this_thread::yield();
+                in_critical_section.fetch_sub(1, std::memory_order_relaxed);
+
+                lock.unlock();
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_FALSE(violation_detected.load());
+    EXPECT_EQ(in_critical_section.load(), 0);
+}
+
+TEST(TicketLockTest, StressTest) {
+    lockfree::TicketLock lock;
+    long long counter = 0;
+    constexpr int NUM_THREADS = 8;
+    constexpr int ITERATIONS = 50000;
+
+    std::vector<std::thread> threads;
+    threads.reserve(NUM_THREADS);
+
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&lock, &counter]() {
+            for (int j = 0; j < ITERATIONS; ++j) {
+                lockfree::TicketLockGuard guard(lock);
+                ++counter;
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(counter, static_cast<long long>(NUM_THREADS) * ITERATIONS);
+}
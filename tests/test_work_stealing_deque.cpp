@@ -0,0 +1,176 @@
+/**
+ * Work-Stealing Deque Test Suite
+ *
+ * Tests for the Chase-Lev deque (owner push/pop at bottom, thieves steal at top)
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include "lockfree/work_stealing_deque.hpp"
+
+// ============================================
+// Basic Functionality Tests
+// ============================================
+
+TEST(WorkStealingDequeTest, EmptyDeque) {
+    lockfree::WorkStealingDeque<int> deque;
+    EXPECT_TRUE(deque.empty());
+    EXPECT_FALSE(deque.pop().has_value());
+    EXPECT_FALSE(deque.steal().has_value());
+}
+
+TEST(WorkStealingDequeTest, OwnerPopIsLIFO) {
+    lockfree::WorkStealingDeque<int> deque;
+    for (int i = 0; i < 10; ++i) {
+        deque.push(i);
+    }
+    EXPECT_EQ(deque.size(), 10u);
+    for (int i = 9; i >= 0; --i) {
+        EXPECT_EQ(deque.pop().value(), i);
+    }
+    EXPECT_TRUE(deque.empty());
+}
+
+TEST(WorkStealingDequeTest, StealIsFIFO) {
+    lockfree::WorkStealingDeque<int> deque;
+    for (int i = 0; i < 10; ++i) {
+        deque.push(i);
+    }
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(deque.steal().value(), i);
+    }
+    EXPECT_FALSE(deque.steal().has_value());
+}
+
+TEST(WorkStealingDequeTest, PopAndStealMeetInTheMiddle) {
+    lockfree::WorkStealingDeque<int> deque;
+    for (int i = 0; i < 4; ++i) {
+        deque.push(i);
+    }
+    EXPECT_EQ(deque.steal().value(), 0);
+    EXPECT_EQ(deque.pop().value(), 3);
+    EXPECT_EQ(deque.steal().value(), 1);
+    EXPECT_EQ(deque.pop().value(), 2);
+    EXPECT_FALSE(deque.pop().has_value());
+    EXPECT_FALSE(deque.steal().has_value());
+}
+
+TEST(WorkStealingDequeTest, GrowsWhenFull) {
+    lockfree::WorkStealingDeque<int> deque(4);
+    EXPECT_EQ(deque.capacity(), 4u);
+
+    // 앞에서 몇 개 훔쳐서 top을 옮긴 뒤 확장 → 감긴 인덱스도 복사되어야 함
+    for (int i = 0; i < 3; ++i) {
+        deque.push(i);
+    }
+    EXPECT_EQ(deque.steal().value(), 0);
+    for (int i = 3; i < 100; ++i) {
+        deque.push(i);
+    }
+    EXPECT_GE(deque.capacity(), 128u);
+
+    for (int i = 1; i < 100; ++i) {
+        EXPECT_EQ(deque.steal().value(), i);
+    }
+}
+
+// ============================================
+// Multithreaded Tests
+// ============================================
+
+TEST(WorkStealingDequeTest, EveryItemTakenExactlyOnce) {
+    lockfree::WorkStealingDeque<int> deque(16);  // 작게 시작 → 도둑이 있는 동안 확장
+    constexpr int NUM_ITEMS = 100000;
+    constexpr int NUM_THIEVES = 3;
+
+    auto taken = std::make_unique<std::atomic<int>[]>(NUM_ITEMS);
+    std::atomic<bool> owner_done{false};
+    std::atomic<int> total{0};
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < NUM_THIEVES; ++t) {
+        thieves.emplace_back([&]() {
+            while (!owner_done.load(std::memory_order_acquire) || !deque.empty()) {
+                if (auto v = deque.steal()) {
+                    taken[*v].fetch_add(1, std::memory_order_relaxed);
+                    total.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // 주인: push와 pop을 섞음 (마지막 원소 경쟁이 자주 일어나도록)
+    for (int i = 0; i < NUM_ITEMS; ++i) {
+        deque.push(i);
+        if (i % 3 == 0) {
+            if (auto v = deque.pop()) {
+                taken[*v].fetch_add(1, std::memory_order_relaxed);
+                total.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    while (auto v = deque.pop()) {
+        taken[*v].fetch_add(1, std::memory_order_relaxed);
+        total.fetch_add(1, std::memory_order_relaxed);
+    }
+    owner_done.store(true, std::memory_order_release);
+
+    for (auto& t : thieves) {
+        t.join();
+    }
+
+    EXPECT_EQ(total.load(), NUM_ITEMS);
+    int duplicates = 0;
+    int missing = 0;
+    for (int i = 0; i < NUM_ITEMS; ++i) {
+        int count = taken[i].load();
+        if (count > 1) ++duplicates;
+        if (count == 0) ++missing;
+    }
+    EXPECT_EQ(duplicates, 0);
+    EXPECT_EQ(missing, 0);
+}
+
+TEST(WorkStealingDequeTest, LastElementRace) {
+    // 원소 하나를 두고 주인 pop과 도둑 steal이 경쟁 → 정확히 한쪽만 가져감
+    lockfree::WorkStealingDeque<int> deque;
+    constexpr int ROUNDS = 20000;
+    std::atomic<int> round{-1};
+    std::atomic<int> thief_wins{0};
+    std::atomic<bool> stop{false};
+
+    std::thread thief([&]() {
+        int seen = -1;
+        while (!stop.load(std::memory_order_acquire)) {
+            int r = round.load(std::memory_order_acquire);
+            if (r == seen) {
+                std::this_thread::yield();
+                continue;
+            }
+            seen = r;
+            if (deque.steal()) {
+                thief_wins.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    });
+
+    int owner_wins = 0;
+    for (int r = 0; r < ROUNDS; ++r) {
+        deque.push(r);
+        round.store(r, std::memory_order_release);
+        if (deque.pop()) {
+            ++owner_wins;
+        }
+        // 도둑이 이 라운드를 끝낼 때까지 기다리지 않아도 됨: 비어 있으면 steal은 실패
+    }
+    stop.store(true, std::memory_order_release);
+    thief.join();
+
+    EXPECT_EQ(owner_wins + thief_wins.load(), ROUNDS);
+    EXPECT_TRUE(deque.empty());
+}